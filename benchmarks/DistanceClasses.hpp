@@ -0,0 +1,93 @@
+#ifndef DISTANCECLASSES_HPP
+#define DISTANCECLASSES_HPP
+
+#include "GeoPoint.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+//REVIEW - Reproducible point pairs grouped by the geometry that stresses the inverse solvers differently
+//NOTE - Shared by the benchmark and by the reference-data generator of the accuracy harness
+namespace Benchmark {
+
+  enum class DistanceClass {
+    Short,         //NOTE - Up to a few kilometres apart
+    Continental,   //NOTE - Hundreds to thousands of kilometres
+    NearAntipodal, //NOTE - Within half a degree of the antipode, where Vincenty converges slowly or not at all
+    Polar,         //NOTE - Both points poleward of 80 degrees
+    Equatorial     //NOTE - Both points on the equator
+  };
+
+  constexpr std::array<DistanceClass, 5> DISTANCE_CLASSES{
+    DistanceClass::Short, DistanceClass::Continental, DistanceClass::NearAntipodal, DistanceClass::Polar, DistanceClass::Equatorial
+  };
+
+  inline auto distance_class_name(DistanceClass distance_class) -> const char* {
+    switch(distance_class) {
+      case DistanceClass::Short:         return "short";
+      case DistanceClass::Continental:   return "continental";
+      case DistanceClass::NearAntipodal: return "near-antipodal";
+      case DistanceClass::Polar:         return "polar";
+      case DistanceClass::Equatorial:    return "equatorial";
+    }
+    return "unknown";
+  }
+
+  struct PointPair {
+    GeoPoint point_1{}, point_2{};
+  };
+
+  inline auto wrap_longitude(double longitude) -> double {
+    return std::remainder(longitude, 360.0); //NOTE - [-180, 180]
+  }
+
+  inline auto clamp_latitude(double latitude) -> double {
+    return (latitude > 90.0) ? 180.0 - latitude : (latitude < -90.0) ? -180.0 - latitude : latitude;
+  }
+
+  //NOTE - The same seed always gives the same pairs, on every platform with a conforming std::mt19937_64
+  inline auto make_pairs(DistanceClass distance_class, std::size_t count, uint64_t seed) -> std::vector<PointPair> {
+    std::mt19937_64 engine{seed + static_cast<uint64_t>(distance_class)};
+
+    //NOTE - Built from raw engine output, the std distributions are not required to be reproducible across libraries
+    auto uniform{[&engine](double low, double high) {
+      return low + (high - low) * (static_cast<double>(engine() >> 11) * 0x1.0p-53);
+    }};
+
+    std::vector<PointPair> pairs(count);
+    for(PointPair &pair : pairs) {
+      switch(distance_class) {
+        case DistanceClass::Short:
+          pair.point_1 = GeoPoint{uniform(-85.0, 85.0), uniform(-180.0, 180.0)};
+          pair.point_2 = GeoPoint{pair.point_1.latitude + uniform(-0.05, 0.05), wrap_longitude(pair.point_1.longitude + uniform(-0.05, 0.05))};
+          break;
+        case DistanceClass::Continental:
+          pair.point_1 = GeoPoint{uniform(-70.0, 70.0), uniform(-180.0, 180.0)};
+          pair.point_2 = GeoPoint{clamp_latitude(pair.point_1.latitude + uniform(-30.0, 30.0)), wrap_longitude(pair.point_1.longitude + uniform(-40.0, 40.0))};
+          break;
+        case DistanceClass::NearAntipodal:
+          pair.point_1 = GeoPoint{uniform(-60.0, 60.0), uniform(-180.0, 180.0)};
+          pair.point_2 = GeoPoint{-pair.point_1.latitude + uniform(-0.5, 0.5), wrap_longitude(pair.point_1.longitude + 180.0 + uniform(-0.5, 0.5))};
+          break;
+        case DistanceClass::Polar: {
+          const double hemisphere{(engine() & 1) ? 1.0 : -1.0};
+          pair.point_1 = GeoPoint{hemisphere * uniform(80.0, 90.0), uniform(-180.0, 180.0)};
+          pair.point_2 = GeoPoint{((engine() & 1) ? hemisphere : -hemisphere) * uniform(80.0, 90.0), uniform(-180.0, 180.0)};
+          break;
+        }
+        case DistanceClass::Equatorial:
+          pair.point_1 = GeoPoint{0.0, uniform(-180.0, 180.0)};
+          pair.point_2 = GeoPoint{0.0, uniform(-180.0, 180.0)};
+          break;
+      }
+    }
+    return pairs;
+  }
+
+};
+
+#endif
@@ -0,0 +1,297 @@
+#include "DistanceClasses.hpp"
+#include "Geodesic.hpp"
+#include "GeodesicBatch.hpp"
+#include "GeodesicKarney.hpp"
+#include "GeodesicTiered.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//REVIEW - Accuracy regression harness
+//NOTE - Usage: geodesic_accuracy REFERENCE_FILE
+//NOTE -        geodesic_accuracy --generate REFERENCE_FILE [PAIRS_PER_CLASS]
+//NOTE - Every solver is checked against the committed reference distances, the process exits with 1 when any of them
+//NOTE - drifts past its tolerance so ctest reports the regression.
+//NOTE - Reference format, one pair per line ('#' lines are comments): lat1 lon1 lat2 lon2 s12 class
+//NOTE - --generate writes the pairs with this code base's Karney distances, benchmarks/geographiclib_reference.py then
+//NOTE - replaces every distance with GeographicLib's so nothing is checked against its own output. The published values
+//NOTE - below pin the solvers independently of the file.
+
+namespace {
+
+  constexpr uint64_t REFERENCE_SEED{0x6E0D7E57u};
+
+  //NOTE - Tolerances in meters
+  constexpr double VINCENTY_TOLERANCE{1e-4};          //NOTE - Vincenty's series truncation on WGS-84 stays well under 0.1 mm
+  constexpr double BATCH_TOLERANCE{1e-4};
+  constexpr double KARNEY_FULL_TOLERANCE{1e-6};       //NOTE - Leaves room for round-off differences between platforms
+  constexpr double KARNEY_MICROMETRE_TOLERANCE{1e-6};
+  constexpr double KARNEY_MILLIMETRE_TOLERANCE{1e-3};
+
+  constexpr double TINY_TOLERANCE{1e-6};              //NOTE - Batch against the scalar solver on near-coincident pairs
+  //NOTE - The batch kernel stops once lambda moves less than its type's tolerance, which on a short equatorial pair can
+  //NOTE - leave b * sigma instead of a * sigma, so the bound is also relative, a little over the flattening
+  constexpr double TINY_RELATIVE_TOLERANCE{4e-3};
+
+  //NOTE - Longitude offsets from (0, 0) down into the subnormal range, their squares underflow inside the kernel
+  constexpr double TINY_SEPARATIONS[]{1e-6, 1e-9, 1e-20, 1e-40, 1e-160, 1e-300, 5e-324};
+
+  //NOTE - Vincenty may give up on pairs this long (near-antipodal, including equatorial pairs more than (1 - f) 180
+  //NOTE - degrees apart), anywhere shorter a NaN is a regression
+  constexpr double VINCENTY_GIVE_UP_DISTANCE{19900000.0};
+
+  struct ReferencePair {
+    GeoPoint point_1{}, point_2{};
+    double distance{};
+    std::string distance_class{};
+  };
+
+  //NOTE - Geodesics with published lengths, tolerance is half the last digit published
+  struct PublishedPair {
+    GeoPoint point_1{}, point_2{};
+    double distance{}, tolerance{};
+  };
+
+  const PublishedPair PUBLISHED_PAIRS[]{
+    {GeoPoint{0.0, 0.0}, GeoPoint{0.5, 179.5}, 19936288.579, 5e-4},         //NOTE - Karney (2013), Algorithms for geodesics
+    {GeoPoint{-30.0, 0.0}, GeoPoint{29.9, 179.8}, 19989832.827610, 5e-7},   //NOTE - Karney (2013), the near-antipodal example
+    {GeoPoint{90.0, 0.0}, GeoPoint{-90.0, 0.0}, 20003931.4586, 5e-5},       //NOTE - Twice the WGS-84 quarter meridian
+    {GeoPoint{0.0, 0.0}, GeoPoint{0.0, 90.0}, 10018754.1714, 5e-5},         //NOTE - Quarter of the WGS-84 equator
+    {GeoPoint{40.6, -73.8}, GeoPoint{49.01666667, 2.55}, 5853226.0, 0.5},  //NOTE - GeographicLib GeodSolve tests from here on
+    {GeoPoint{0.07476, 0.0}, GeoPoint{-0.07476, 180.0}, 20003931.4586, 5e-5},
+    {GeoPoint{0.1, 0.0}, GeoPoint{-0.1, 180.0}, 20003931.4586, 5e-5},
+    {GeoPoint{0.0, 0.0}, GeoPoint{0.0, 179.5}, 19980862.0, 0.5},
+    {GeoPoint{36.493349428792, 0.0}, GeoPoint{36.49334942879201, 0.0000008}, 0.072, 5e-4},
+    {GeoPoint{0.0, 539.0}, GeoPoint{0.0, 181.0}, 222639.0, 0.5}
+  };
+
+  //NOTE - vincenty_inverse_WGS84 must keep the original solver's rounding, these pairs flip between converging and NaN
+  //NOTE - as soon as its expression order changes
+  const PublishedPair VINCENTY_PINNED_PAIRS[]{
+    {GeoPoint{10.0, 20.0}, GeoPoint{65.0, -160.0}, 11686737.50808, 1e-5}
+  };
+
+  class Check {
+
+    private:
+      std::string m_name{};
+      double m_tolerance{}, m_worst{0};
+      std::size_t m_checked{0}, m_failed{0}, m_not_converged{0};
+      std::string m_worst_line{};
+
+    public:
+      Check(std::string name, double tolerance):
+      m_name{std::move(name)}, m_tolerance{tolerance} {
+        //TODO - Constructor empty
+      }
+
+      //NOTE - NaN results are counted apart, the caller decides where non-convergence is acceptable
+      auto add(double value, double expected, std::size_t line) -> void {
+        ++m_checked;
+        if(std::isnan(value)) {
+          ++m_not_converged;
+          return;
+        }
+        const double error{std::abs(value - expected)};
+        if(error > m_worst) {
+          m_worst = error;
+          m_worst_line = std::to_string(line);
+        }
+        if(error > m_tolerance) {
+          ++m_failed;
+        }
+      }
+
+      auto not_converged() const -> std::size_t {
+        return m_not_converged;
+      }
+
+      auto report() const -> bool {
+        std::printf("  %-22s %8zu checked  worst %.3e m (line %s)  tolerance %.0e m  %zu over  %zu non-converged\n",
+          m_name.c_str(), m_checked, m_worst, m_worst_line.empty() ? "-" : m_worst_line.c_str(), m_tolerance, m_failed, m_not_converged);
+        return m_failed == 0;
+      }
+
+  };
+
+  auto read_reference(const std::string &path, std::vector<ReferencePair> &pairs, std::vector<std::size_t> &lines) -> bool {
+    std::ifstream input{path};
+    if(!input) {
+      std::cerr << "Reference file could not be opened: " << path << "\n";
+      return false;
+    }
+
+    std::string text{};
+    for(std::size_t line = 1; std::getline(input, text); ++line) {
+      if(text.empty() || text.front() == '#') {
+        continue;
+      }
+      std::istringstream fields{text};
+      ReferencePair pair{};
+      if(!(fields >> pair.point_1.latitude >> pair.point_1.longitude >> pair.point_2.latitude >> pair.point_2.longitude >> pair.distance >> pair.distance_class)) {
+        std::cerr << "Malformed reference line " << line << ": " << text << "\n";
+        return false;
+      }
+      pairs.push_back(pair);
+      lines.push_back(line);
+    }
+    return true;
+  }
+
+  auto generate(const std::string &path, std::size_t per_class) -> int {
+    std::ofstream output{path};
+    if(!output) {
+      std::cerr << "Reference file could not be created: " << path << "\n";
+      return 1;
+    }
+
+    output << "# Geodesic inverse reference distances on WGS-84, written by geodesic_accuracy --generate\n"
+           << "# Distances from the Karney solver in Full accuracy mode, run benchmarks/geographiclib_reference.py on this file\n"
+           << "# lat1 lon1 lat2 lon2 s12 class (degrees, meters)\n";
+
+    char line[256];
+    for(const Benchmark::DistanceClass distance_class : Benchmark::DISTANCE_CLASSES) {
+      for(const Benchmark::PointPair &pair : Benchmark::make_pairs(distance_class, per_class, REFERENCE_SEED)) {
+        //NOTE - Coordinates are rounded to what the file holds first, so the distance belongs to the written pair
+        std::snprintf(line, sizeof(line), "%.10f %.10f %.10f %.10f", pair.point_1.latitude, pair.point_1.longitude, pair.point_2.latitude, pair.point_2.longitude);
+
+        GeoPoint point_1{}, point_2{};
+        std::sscanf(line, "%lf %lf %lf %lf", &point_1.latitude, &point_1.longitude, &point_2.latitude, &point_2.longitude);
+        const double distance{Geodesic::karney_inverse_WGS84(point_1, point_2, Geodesic::KarneyAccuracy::Full)};
+
+        output << line;
+        std::snprintf(line, sizeof(line), " %.9f %s\n", distance, Benchmark::distance_class_name(distance_class));
+        output << line;
+      }
+    }
+    return output ? 0 : 1;
+  }
+
+};
+
+auto main(int argc, char **argv) -> decltype(argc) {
+
+  const std::vector<std::string> arguments(argv, argv + argc);
+
+  if(arguments.size() >= 3 && arguments[1] == "--generate") {
+    return generate(arguments[2], (arguments.size() >= 4) ? std::stoul(arguments[3]) : 2000);
+  }
+  if(arguments.size() != 2) {
+    std::cerr << "Usage: geodesic_accuracy REFERENCE_FILE\n"
+              << "       geodesic_accuracy --generate REFERENCE_FILE [PAIRS_PER_CLASS]\n";
+    return 1;
+  }
+
+  std::vector<ReferencePair> pairs{};
+  std::vector<std::size_t> lines{};
+  if(!read_reference(arguments[1], pairs, lines) || pairs.empty()) {
+    std::cerr << "No reference pairs read from " << arguments[1] << "\n";
+    return 1;
+  }
+
+  bool passed{true};
+
+  std::printf("published values\n");
+  for(const PublishedPair &pair : PUBLISHED_PAIRS) {
+    const double distance{Geodesic::karney_inverse_WGS84(pair.point_1, pair.point_2, Geodesic::KarneyAccuracy::Full)};
+    const bool ok{std::abs(distance - pair.distance) <= pair.tolerance};
+    std::printf("  (%g, %g) -> (%g, %g)  %.4f m, expected %.4f m  %s\n", pair.point_1.latitude, pair.point_1.longitude,
+      pair.point_2.latitude, pair.point_2.longitude, distance, pair.distance, ok ? "ok" : "FAILED");
+    passed = passed && ok;
+  }
+
+  std::printf("pinned vincenty values\n");
+  for(const PublishedPair &pair : VINCENTY_PINNED_PAIRS) {
+    const double distance{static_cast<double>(Geodesic::vincenty_inverse_WGS84(pair.point_1, pair.point_2))};
+    const bool ok{std::abs(distance - pair.distance) <= pair.tolerance};
+    std::printf("  (%g, %g) -> (%g, %g)  %.5f m, expected %.5f m  %s\n", pair.point_1.latitude, pair.point_1.longitude,
+      pair.point_2.latitude, pair.point_2.longitude, distance, pair.distance, ok ? "ok" : "FAILED");
+    passed = passed && ok;
+  }
+
+  std::printf("tiny separations\n");
+  for(const double separation : TINY_SEPARATIONS) {
+    const double zero{0}, longitude{separation};
+    const float zero_f{0}, longitude_f{static_cast<float>(separation)};
+    double batch_distance{};
+    float batch_distance_f{};
+    Geodesic::distance_batch(&zero, &zero, &zero, &longitude, &batch_distance, 1);
+    Geodesic::distance_batch(&zero_f, &zero_f, &zero_f, &longitude_f, &batch_distance_f, 1);
+
+    const double expected{static_cast<double>(Geodesic::vincenty_inverse_WGS84(0, 0, 0, longitude))};
+    const double expected_f{static_cast<double>(Geodesic::vincenty_inverse_WGS84(0, 0, 0, longitude_f))};
+    const bool ok{
+      batch_distance >= 0 && std::abs(batch_distance - expected) <= TINY_TOLERANCE + expected * TINY_RELATIVE_TOLERANCE &&
+      batch_distance_f >= 0 &&
+      std::abs(batch_distance_f - expected_f) <= TINY_TOLERANCE + expected_f * TINY_RELATIVE_TOLERANCE
+    };
+    std::printf("  (0, 0) -> (0, %g)  double %.6e m, float %.6e m, expected %.6e m  %s\n", separation, batch_distance,
+      static_cast<double>(batch_distance_f), expected, ok ? "ok" : "FAILED");
+    passed = passed && ok;
+  }
+
+  std::printf("%zu reference pairs\n", pairs.size());
+
+  Check vincenty{"vincenty", VINCENTY_TOLERANCE};
+  Check batch{"batch", BATCH_TOLERANCE};
+  Check karney_full{"karney full", KARNEY_FULL_TOLERANCE};
+  Check karney_micrometre{"karney micrometre", KARNEY_MICROMETRE_TOLERANCE};
+  Check karney_millimetre{"karney millimetre", KARNEY_MILLIMETRE_TOLERANCE};
+  Check exact{"tiered exact", VINCENTY_TOLERANCE};
+  std::size_t unexpected_nan{0}, bound_violations{0};
+
+  std::vector<GeoPoint> points_1(pairs.size()), points_2(pairs.size());
+  std::vector<double> batch_distance(pairs.size());
+  for(std::size_t i = 0; i < pairs.size(); ++i) {
+    points_1[i] = pairs[i].point_1;
+    points_2[i] = pairs[i].point_2;
+  }
+  Geodesic::distance_batch(points_1.data(), points_2.data(), batch_distance.data(), pairs.size());
+
+  for(std::size_t i = 0; i < pairs.size(); ++i) {
+    const ReferencePair &pair{pairs[i]};
+
+    const double vincenty_distance{static_cast<double>(Geodesic::vincenty_inverse_WGS84(pair.point_1, pair.point_2))};
+    vincenty.add(vincenty_distance, pair.distance, lines[i]);
+    batch.add(batch_distance[i], pair.distance, lines[i]);
+    if((std::isnan(vincenty_distance) || std::isnan(batch_distance[i])) && pair.distance < VINCENTY_GIVE_UP_DISTANCE) {
+      ++unexpected_nan;
+    }
+
+    karney_full.add(Geodesic::karney_inverse_WGS84(pair.point_1, pair.point_2, Geodesic::KarneyAccuracy::Full), pair.distance, lines[i]);
+    karney_micrometre.add(Geodesic::karney_inverse_WGS84(pair.point_1, pair.point_2, Geodesic::KarneyAccuracy::Micrometre), pair.distance, lines[i]);
+    karney_millimetre.add(Geodesic::karney_inverse_WGS84(pair.point_1, pair.point_2, Geodesic::KarneyAccuracy::Millimetre), pair.distance, lines[i]);
+    exact.add(Geodesic::exact_distance_WGS84(pair.point_1, pair.point_2), pair.distance, lines[i]);
+
+    const Geodesic::DistanceEstimate estimate{Geodesic::approximate_distance_WGS84(pair.point_1, pair.point_2)};
+    if(std::abs(estimate.distance - pair.distance) > estimate.error_bound) {
+      ++bound_violations;
+    }
+  }
+
+  passed = vincenty.report() && passed;
+  passed = batch.report() && passed;
+  passed = karney_full.report() && passed;
+  passed = karney_micrometre.report() && passed;
+  passed = karney_millimetre.report() && passed;
+  passed = exact.report() && passed;
+
+  //NOTE - Only the Vincenty solvers may fail to converge, the fallbacks and Karney never should
+  const std::size_t never_nan{karney_full.not_converged() + karney_micrometre.not_converged() + karney_millimetre.not_converged() + exact.not_converged()};
+  std::printf("  vincenty / batch non-converged below %.0f m: %zu\n", VINCENTY_GIVE_UP_DISTANCE, unexpected_nan);
+  std::printf("  non-converged Karney / tiered results: %zu\n", never_nan);
+  std::printf("  approximate estimates outside their error bound: %zu\n", bound_violations);
+  passed = passed && unexpected_nan == 0 && never_nan == 0 && bound_violations == 0;
+
+  std::printf("%s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,229 @@
+#include "DistanceClasses.hpp"
+#include "DistanceMatrix.hpp"
+#include "Geodesic.hpp"
+#include "GeodesicBatch.hpp"
+#include "ThreadPool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+//REVIEW - Throughput of the Vincenty inverse solver per distance class and thread count
+//NOTE - Usage: geodesic_benchmark [--pairs N] [--repeat R] [--threads N] [--matrix POINTS]
+//NOTE - Every figure is the best of R timed runs over the same pairs, the sum of the results is kept alive so the
+//NOTE - compiler cannot drop the calls. The last table is the symmetric POINTS x POINTS distance matrix at every thread
+//NOTE - count, with its speedup and parallel efficiency against one thread.
+
+namespace {
+
+  constexpr uint64_t BENCHMARK_SEED{0x5EEDu};
+
+  using Clock = std::chrono::steady_clock;
+
+  struct Timing {
+    double seconds{};
+    long double checksum{};
+  };
+
+  auto print_rate(const std::string &label, std::size_t pairs, const Timing &timing) -> void {
+    std::cout << "  " << std::left << std::setw(22) << label << std::right
+              << std::setw(14) << std::fixed << std::setprecision(0) << static_cast<double>(pairs) / timing.seconds << " pairs/s"
+              << std::setw(10) << std::setprecision(1) << timing.seconds * 1e9 / static_cast<double>(pairs) << " ns/pair\n";
+  }
+
+  template<typename Run>
+  auto best_of(std::size_t repeat, Run run) -> Timing {
+    Timing best{};
+    for(std::size_t r = 0; r < repeat; ++r) {
+      const auto start{Clock::now()};
+      const long double checksum{run()};
+      const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+      if(r == 0 || seconds < best.seconds) {
+        best = Timing{seconds, checksum};
+      }
+    }
+    return best;
+  }
+
+  auto scalar_range(const Benchmark::PointPair *pairs, std::size_t count) -> long double {
+    long double checksum{0};
+    for(std::size_t i = 0; i < count; ++i) {
+      const long double distance{Geodesic::vincenty_inverse_WGS84(pairs[i].point_1, pairs[i].point_2)};
+      checksum += std::isnan(distance) ? 0 : distance;
+    }
+    return checksum;
+  }
+
+  //NOTE - Converged pairs take fewer than VINCENTY_ITERATION_LIMIT iterations, the limit itself marks a non-converged pair.
+  //NOTE - Counts past HISTOGRAM_DETAIL are grouped by tens to keep the slow near-antipodal tail readable.
+  constexpr unsigned HISTOGRAM_DETAIL{20};
+
+  auto print_iterations(const std::vector<Benchmark::PointPair> &pairs) -> void {
+    std::vector<std::size_t> histogram(Geodesic::VINCENTY_ITERATION_LIMIT + 1, 0);
+    std::size_t total{0};
+
+    for(const Benchmark::PointPair &pair : pairs) {
+      unsigned iterations{0};
+      Geodesic::vincenty_inverse_WGS84(pair.point_1, pair.point_2, &iterations);
+      ++histogram[std::min<unsigned>(iterations, Geodesic::VINCENTY_ITERATION_LIMIT)];
+      total += iterations;
+    }
+
+    std::cout << "  iterations            mean " << std::setprecision(2) << static_cast<double>(total) / static_cast<double>(pairs.size())
+              << ", non-converged " << histogram[Geodesic::VINCENTY_ITERATION_LIMIT] << "\n  histogram            ";
+    for(unsigned low = 0; low < Geodesic::VINCENTY_ITERATION_LIMIT;) {
+      const unsigned high{std::min((low < HISTOGRAM_DETAIL) ? low + 1 : low + 10, Geodesic::VINCENTY_ITERATION_LIMIT)};
+      std::size_t count{0};
+      for(unsigned iterations = low; iterations < high; ++iterations) {
+        count += histogram[iterations];
+      }
+      if(count > 0) {
+        std::cout << " " << low;
+        if(high - low > 1) {
+          std::cout << "-" << high - 1;
+        }
+        std::cout << ":" << count;
+      }
+      low = high;
+    }
+    std::cout << "\n";
+  }
+
+};
+
+auto main(int argc, char **argv) -> decltype(argc) {
+
+  std::size_t pair_count{200000}, repeat{3}, max_threads{std::max(1u, std::thread::hardware_concurrency())}, matrix_points{2000};
+
+  const std::vector<std::string> arguments(argv, argv + argc);
+  for(std::size_t i = 1; i + 1 < arguments.size(); i += 2) {
+    if(arguments[i] == "--pairs") {
+      pair_count = std::stoul(arguments[i + 1]);
+    }
+    else if(arguments[i] == "--repeat") {
+      repeat = std::max<std::size_t>(1, std::stoul(arguments[i + 1]));
+    }
+    else if(arguments[i] == "--threads") {
+      max_threads = std::max<std::size_t>(1, std::stoul(arguments[i + 1]));
+    }
+    else if(arguments[i] == "--matrix") {
+      matrix_points = std::stoul(arguments[i + 1]);
+    }
+    else {
+      std::cerr << "Usage: geodesic_benchmark [--pairs N] [--repeat R] [--threads N] [--matrix POINTS]\n";
+      return 1;
+    }
+  }
+  if(arguments.size() % 2 == 0 || pair_count == 0 || matrix_points == 0) {
+    std::cerr << "Usage: geodesic_benchmark [--pairs N] [--repeat R] [--threads N] [--matrix POINTS]\n";
+    return 1;
+  }
+
+  //NOTE - Thread counts 1, 2, 4, ... up to max_threads, which is always measured
+  std::vector<std::size_t> thread_counts{};
+  for(std::size_t threads = 1; threads < max_threads; threads *= 2) {
+    thread_counts.push_back(threads);
+  }
+  thread_counts.push_back(max_threads);
+
+  std::cout << pair_count << " pairs per class, best of " << repeat << ", batch kernel "
+            << Geodesic::batch_isa_name(Geodesic::batch_isa()) << "\n";
+
+  long double checksum{0};
+
+  for(const Benchmark::DistanceClass distance_class : Benchmark::DISTANCE_CLASSES) {
+    const std::vector<Benchmark::PointPair> pairs{Benchmark::make_pairs(distance_class, pair_count, BENCHMARK_SEED)};
+    std::cout << "\n" << Benchmark::distance_class_name(distance_class) << "\n";
+
+    for(const std::size_t threads : thread_counts) {
+      Timing timing{};
+      if(threads == 1) {
+        timing = best_of(repeat, [&pairs]() { return scalar_range(pairs.data(), pairs.size()); });
+      }
+      else {
+        //NOTE - A few tasks per thread so the stealing pool can even out slow near-antipodal stretches
+        ThreadPool pool{threads};
+        const std::size_t tasks{threads * 4}, step{(pairs.size() + tasks - 1) / tasks};
+        std::vector<long double> partial(tasks, 0);
+
+        timing = best_of(repeat, [&]() {
+          for(std::size_t t = 0; t < tasks; ++t) {
+            const std::size_t begin{std::min(pairs.size(), t * step)}, end{std::min(pairs.size(), begin + step)};
+            pool.submit([&pairs, &partial, t, begin, end]() { partial[t] = scalar_range(pairs.data() + begin, end - begin); });
+          }
+          pool.wait();
+
+          long double sum{0};
+          for(const long double value : partial) {
+            sum += value;
+          }
+          return sum;
+        });
+      }
+      print_rate("vincenty x" + std::to_string(threads), pairs.size(), timing);
+      checksum += timing.checksum;
+    }
+
+    std::vector<GeoPoint> points_1(pairs.size()), points_2(pairs.size());
+    for(std::size_t i = 0; i < pairs.size(); ++i) {
+      points_1[i] = pairs[i].point_1;
+      points_2[i] = pairs[i].point_2;
+    }
+    std::vector<double> distance(pairs.size());
+    const Timing batch{best_of(repeat, [&]() {
+      Geodesic::distance_batch(points_1.data(), points_2.data(), distance.data(), distance.size());
+      long double sum{0};
+      for(const double value : distance) {
+        sum += std::isnan(value) ? 0 : value;
+      }
+      return sum;
+    })};
+    print_rate("batch x1", pairs.size(), batch);
+    checksum += batch.checksum;
+
+    print_iterations(pairs);
+  }
+
+  //SECTION - Multi-core scaling of the distance matrix
+  {
+    std::vector<GeoPoint> points(matrix_points);
+    const std::vector<Benchmark::PointPair> pairs{Benchmark::make_pairs(Benchmark::DistanceClass::Continental, matrix_points, BENCHMARK_SEED)};
+    for(std::size_t i = 0; i < matrix_points; ++i) {
+      points[i] = pairs[i].point_1;
+    }
+    std::vector<double> distance(matrix_points * matrix_points);
+    const std::size_t solved{matrix_points * (matrix_points - 1) / 2};
+
+    std::cout << "\nmatrix " << matrix_points << " x " << matrix_points << " symmetric, " << solved << " solved pairs\n";
+    double single_thread_seconds{0};
+    for(const std::size_t threads : thread_counts) {
+      Geodesic::DistanceMatrix matrix{Geodesic::MatrixOptions{}, threads};
+      const Timing timing{best_of(repeat, [&]() {
+        matrix.compute(points.data(), points.size(), distance.data());
+        long double sum{0};
+        for(const double value : distance) {
+          sum += std::isnan(value) ? 0 : value;
+        }
+        return sum;
+      })};
+      if(threads == 1) {
+        single_thread_seconds = timing.seconds;
+      }
+      print_rate("matrix x" + std::to_string(threads), solved, timing);
+      const double speedup{single_thread_seconds / timing.seconds};
+      std::cout << "  " << std::setw(36) << std::setprecision(2) << speedup << "x speedup" << std::setw(10) << std::setprecision(0)
+                << 100 * speedup / static_cast<double>(threads) << " % efficiency\n";
+      checksum += timing.checksum;
+    }
+  }
+
+  std::cout << "\nchecksum " << std::setprecision(3) << static_cast<double>(checksum) << "\n";
+  return 0;
+
+}
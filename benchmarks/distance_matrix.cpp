@@ -0,0 +1,169 @@
+#include "DistanceClasses.hpp"
+#include "DistanceMatrix.hpp"
+#include "ThreadPool.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+//REVIEW - Distance matrix regression
+//NOTE - Usage: geodesic_distance_matrix
+//NOTE - Near-antipodal points make a share of the cells NaN. In both layouts the symmetric matrix must equal the same
+//NOTE - set computed as separate origins and destinations on and above the diagonal and mirror itself below it. Every
+//NOTE - NaN cell must lie in a reported failure range, the counts must add up, and with square tiles the ranges must be
+//NOTE - disjoint and count exactly the NaN cells inside them. The pool must hand a task's exception to wait() and keep
+//NOTE - working.
+
+namespace {
+
+  constexpr uint64_t MATRIX_SEED{0x3A7Bu};
+  constexpr std::size_t ANTIPODAL_PAIRS{160}; //NOTE - Both ends of every pair become points
+  constexpr std::size_t THREADS{3};
+
+  auto same(double lhs, double rhs) -> bool {
+    return (std::isnan(lhs) && std::isnan(rhs)) || lhs == rhs;
+  }
+
+  auto check_layout(const char *name, Geodesic::MatrixOptions options, const std::vector<GeoPoint> &points) -> bool {
+    const std::size_t count{points.size()};
+    Geodesic::DistanceMatrix matrix{options, THREADS};
+
+    //NOTE - A copy on the destination side keeps compute() out of symmetric mode
+    const std::vector<GeoPoint> destinations{points};
+    std::vector<double> full(matrix.buffer_size(count, count)), symmetric(matrix.buffer_size(count, count));
+    matrix.compute(points.data(), count, destinations.data(), count, full.data());
+    const Geodesic::MatrixReport report{matrix.compute(points.data(), count, symmetric.data())};
+
+    auto cell = [&](const std::vector<double> &values, std::size_t row, std::size_t column) -> double {
+      return values[matrix.index(count, count, row, column)];
+    };
+
+    std::size_t wrong_cells{0}, nan_cells{0};
+    std::vector<std::size_t> covered(count * count, 0);
+    for(std::size_t row = 0; row < count; ++row) {
+      for(std::size_t column = 0; column < count; ++column) {
+        const double value{cell(symmetric, row, column)};
+        const double expected{
+          (row == column) ? 0.0 : (row < column) ? cell(full, row, column) : cell(symmetric, column, row)
+        };
+        if(!same(value, expected)) {
+          ++wrong_cells;
+        }
+        if(std::isnan(value)) {
+          ++nan_cells;
+        }
+      }
+    }
+
+    //NOTE - A tile straddling the diagonal with unequal sides also spans mirrored cells another tile counts, so only
+    //NOTE - square tiles give disjoint ranges
+    const bool exact_ranges{options.tile_rows == options.tile_columns};
+    std::size_t listed{0}, miscounted_ranges{0}, unsorted_ranges{0};
+    for(std::size_t i = 0; i < report.failures.size(); ++i) {
+      const Geodesic::TileFailure &failure{report.failures[i]};
+      std::size_t inside{0};
+      for(std::size_t row = failure.row_begin; row < failure.row_end; ++row) {
+        for(std::size_t column = failure.column_begin; column < failure.column_end; ++column) {
+          ++covered[row * count + column];
+          if(std::isnan(cell(symmetric, row, column))) {
+            ++inside;
+          }
+        }
+      }
+      if(failure.failed_pairs == 0 || failure.failed_pairs > inside || (exact_ranges && failure.failed_pairs != inside)) {
+        ++miscounted_ranges;
+      }
+      if(i > 0 && (report.failures[i - 1].row_begin > failure.row_begin ||
+         (report.failures[i - 1].row_begin == failure.row_begin && report.failures[i - 1].column_begin > failure.column_begin))) {
+        ++unsorted_ranges;
+      }
+      listed += failure.failed_pairs;
+    }
+
+    std::size_t unlisted{0}, overlapping{0};
+    for(std::size_t row = 0; row < count; ++row) {
+      for(std::size_t column = 0; column < count; ++column) {
+        if(exact_ranges && covered[row * count + column] > 1) {
+          ++overlapping;
+        }
+        if(std::isnan(cell(symmetric, row, column)) && covered[row * count + column] == 0) {
+          ++unlisted;
+        }
+      }
+    }
+
+    const bool ok{
+      wrong_cells == 0 && nan_cells > 0 && report.failed_pairs == nan_cells && listed == nan_cells &&
+      miscounted_ranges == 0 && unsorted_ranges == 0 && unlisted == 0 && overlapping == 0
+    };
+    std::printf("  %-16s %zu NaN cells, %zu reported in %zu ranges  %zu wrong cells, %zu miscounted, %zu unsorted, %zu overlapping, %zu unlisted  %s\n",
+      name, nan_cells, report.failed_pairs, report.failures.size(), wrong_cells, miscounted_ranges, unsorted_ranges, overlapping, unlisted, ok ? "ok" : "FAILED");
+    return ok;
+  }
+
+  auto check_pool_exceptions() -> bool {
+    ThreadPool pool{THREADS};
+    std::size_t caught{0};
+    for(std::size_t round = 0; round < 2; ++round) {
+      for(std::size_t i = 0; i < 64; ++i) {
+        pool.submit([i] {
+          if(i % 16 == 5) {
+            throw std::runtime_error("task failed");
+          }
+        });
+      }
+      try {
+        pool.wait();
+      }
+      catch(const std::runtime_error &error) {
+        static_cast<void>(error);
+        ++caught;
+      }
+    }
+
+    bool ran{false};
+    pool.submit([&ran] { ran = true; });
+    pool.wait();
+
+    const bool ok{caught == 2 && ran};
+    std::printf("  %-16s %zu of 2 failing rounds rethrown by wait(), pool %s afterwards  %s\n", "pool", caught, ran ? "working" : "dead", ok ? "ok" : "FAILED");
+    return ok;
+  }
+
+};
+
+auto main() -> int {
+
+  std::vector<GeoPoint> points{};
+  for(const Benchmark::PointPair &pair : Benchmark::make_pairs(Benchmark::DistanceClass::NearAntipodal, ANTIPODAL_PAIRS, MATRIX_SEED)) {
+    points.push_back(pair.point_1);
+    points.push_back(pair.point_2);
+  }
+
+  //NOTE - Small tiles that do not divide the point count, so edge tiles and diagonal tiles are both exercised
+  Geodesic::MatrixOptions row_major{};
+  row_major.tile_rows    = 24;
+  row_major.tile_columns = 40;
+  Geodesic::MatrixOptions tiled{row_major};
+  tiled.layout = Geodesic::MatrixLayout::Tiled;
+  Geodesic::MatrixOptions square{};
+  square.tile_rows    = 24;
+  square.tile_columns = 24;
+  Geodesic::MatrixOptions square_tiled{square};
+  square_tiled.layout = Geodesic::MatrixLayout::Tiled;
+
+  std::printf("distance matrix, %zu points\n", points.size());
+  bool passed{true};
+  passed = check_layout("row-major", row_major, points) && passed;
+  passed = check_layout("tiled", tiled, points) && passed;
+  passed = check_layout("row-major square", square, points) && passed;
+  passed = check_layout("tiled square", square_tiled, points) && passed;
+  passed = check_pool_exceptions() && passed;
+
+  std::printf("%s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,142 @@
+#include "DistanceClasses.hpp"
+#include "DistanceStream.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//REVIEW - Distance stream regression
+//NOTE - Usage: geodesic_distance_stream
+//NOTE - With several compute threads and chunks of a few pairs, chunks finish out of order, the output must still match
+//NOTE - a single-threaded run byte for byte in both formats. A CSV header is only skipped on the first line that is
+//NOTE - neither blank nor a comment, every other malformed line throws with its line number counting all lines read.
+
+namespace {
+
+  constexpr uint64_t STREAM_SEED{0x57EAu};
+  constexpr std::size_t PAIRS_PER_CLASS{400};
+
+  //NOTE - Small and not dividing the pair count, so most chunks are in flight at once and the last one is partial
+  constexpr std::size_t CHUNK_PAIRS{7};
+  constexpr std::size_t CHUNKS_IN_FLIGHT{5};
+  constexpr std::size_t THREADS{4};
+
+  auto threaded_options(Geodesic::StreamFormat format) -> Geodesic::StreamOptions {
+    Geodesic::StreamOptions options{};
+    options.format           = format;
+    options.chunk_pairs      = CHUNK_PAIRS;
+    options.chunks_in_flight = CHUNKS_IN_FLIGHT;
+    options.compute_threads  = THREADS;
+    return options;
+  }
+
+  auto run(const std::string &input, const Geodesic::StreamOptions &options, Geodesic::StreamReport &report) -> std::string {
+    std::istringstream in{input};
+    std::ostringstream out{};
+    report = Geodesic::stream_distances(in, out, options);
+    return out.str();
+  }
+
+  auto check_order(const char *name, const std::string &input, Geodesic::StreamFormat format, std::size_t pairs) -> bool {
+    Geodesic::StreamOptions single{};
+    single.format = format;
+
+    Geodesic::StreamReport single_report{}, threaded_report{};
+    const std::string expected{run(input, single, single_report)};
+    const std::string output{run(input, threaded_options(format), threaded_report)};
+
+    const bool ok{
+      output == expected && single_report.pairs == pairs && threaded_report.pairs == pairs &&
+      threaded_report.failed_pairs == single_report.failed_pairs
+    };
+    std::printf("  %-34s %zu pairs, %zu failed, output %s  %s\n",
+      name, threaded_report.pairs, threaded_report.failed_pairs, (output == expected) ? "identical" : "differs", ok ? "ok" : "FAILED");
+    return ok;
+  }
+
+  //NOTE - The input must parse to pairs distances
+  auto check_accepted(const char *name, const std::string &input, std::size_t pairs) -> bool {
+    bool ok{false};
+    try {
+      Geodesic::StreamReport report{};
+      run(input, threaded_options(Geodesic::StreamFormat::Csv), report);
+      ok = report.pairs == pairs;
+      std::printf("  %-34s %zu of %zu pairs  %s\n", name, report.pairs, pairs, ok ? "ok" : "FAILED");
+    }
+    catch(const std::exception &error) {
+      std::printf("  %-34s unexpected error %s  FAILED\n", name, error.what());
+    }
+    return ok;
+  }
+
+  //NOTE - The input must throw std::runtime_error naming line_number
+  auto check_rejected(const char *name, const std::string &input, std::size_t line_number) -> bool {
+    const std::string expected{"(line " + std::to_string(line_number) + ":"};
+    bool ok{false};
+    try {
+      Geodesic::StreamReport report{};
+      run(input, threaded_options(Geodesic::StreamFormat::Csv), report);
+      std::printf("  %-34s accepted %zu pairs, expected an error at line %zu  FAILED\n", name, report.pairs, line_number);
+    }
+    catch(const std::runtime_error &error) {
+      ok = std::string{error.what()}.find(expected) != std::string::npos;
+      std::printf("  %-34s rejected, expected line %zu  %s\n", name, line_number, ok ? "ok" : "FAILED");
+    }
+    return ok;
+  }
+
+};
+
+auto main() -> int {
+
+  //NOTE - Classes interleaved so neighbouring chunks differ in cost, near-antipodal pairs add nan lines
+  std::vector<Benchmark::PointPair> pairs{};
+  {
+    std::vector<std::vector<Benchmark::PointPair>> classes{};
+    for(Benchmark::DistanceClass distance_class : Benchmark::DISTANCE_CLASSES) {
+      classes.push_back(Benchmark::make_pairs(distance_class, PAIRS_PER_CLASS, STREAM_SEED));
+    }
+    for(std::size_t i = 0; i < PAIRS_PER_CLASS; ++i) {
+      for(const std::vector<Benchmark::PointPair> &class_pairs : classes) {
+        pairs.push_back(class_pairs[i]);
+      }
+    }
+  }
+
+  std::string csv{}, binary{};
+  for(const Benchmark::PointPair &pair : pairs) {
+    char line[128];
+    std::snprintf(line, sizeof(line), "%.17g,%.17g,%.17g,%.17g\n",
+      pair.point_1.latitude, pair.point_1.longitude, pair.point_2.latitude, pair.point_2.longitude);
+    csv += line;
+
+    const double values[4]{pair.point_1.latitude, pair.point_1.longitude, pair.point_2.latitude, pair.point_2.longitude};
+    binary.append(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+
+  std::printf("distance stream, %zu compute threads, %zu pairs per chunk\n", THREADS, CHUNK_PAIRS);
+  bool passed{true};
+
+  passed = check_order("csv order", csv, Geodesic::StreamFormat::Csv, pairs.size()) && passed;
+  passed = check_order("binary order", binary, Geodesic::StreamFormat::Binary, pairs.size()) && passed;
+  passed = check_order("csv order, header and comments", "# pairs\n\nlat1,lon1,lat2,lon2\n" + csv, Geodesic::StreamFormat::Csv, pairs.size()) && passed;
+
+  passed = check_accepted("header", "lat1,lon1,lat2,lon2\n1,2,3,4\n", 1) && passed;
+  passed = check_accepted("header after comment and blank", "# pairs\n\n latitude_1 , longitude_1,latitude_2,longitude_2\r\n1,2,3,4\n5,6,7,8", 2) && passed;
+  passed = check_accepted("comments and blanks only", "# pairs\n\n   \n", 0) && passed;
+
+  passed = check_rejected("header after a record", "1,2,3,4\nlat1,lon1,lat2,lon2\n", 2) && passed;
+  passed = check_rejected("short first record", "1,2,3\n1,2,3,4\n", 1) && passed;
+  passed = check_rejected("header with three fields", "lat1,lon1,lat2\n1,2,3,4\n", 1) && passed;
+  passed = check_rejected("short record after comment", "# pairs\n\n1,2,3,4\n1,2\n", 4) && passed;
+  passed = check_rejected("trailing field", "1,2,3,4\n1,2,3,4,5\n", 2) && passed;
+  passed = check_rejected("malformed line chunks later", "# pairs\n" + csv + "1,2,3,x\n" + csv, pairs.size() + 2) && passed;
+
+  std::printf("%s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+
+}
@@ -0,0 +1,34 @@
+#!/usr/bin/env python3
+# Replaces the distances of a reference file written by geodesic_accuracy --generate with GeographicLib's, so the
+# accuracy harness checks this code base against an implementation it did not produce.
+# Usage: python3 geographiclib_reference.py REFERENCE_FILE     (pip install geographiclib)
+
+import sys
+
+import geographiclib
+from geographiclib.geodesic import Geodesic
+
+HEADER = (
+    "# Geodesic inverse reference distances on WGS-84, pairs written by geodesic_accuracy --generate\n"
+    "# Distances from GeographicLib {} (Python, Geodesic.WGS84.Inverse) via benchmarks/geographiclib_reference.py\n"
+    "# lat1 lon1 lat2 lon2 s12 class (degrees, meters)\n"
+)
+
+
+def main(path):
+    with open(path) as reference:
+        lines = [line for line in reference if not line.startswith("#")]
+
+    with open(path, "w") as reference:
+        reference.write(HEADER.format(geographiclib.__version__))
+        for line in lines:
+            fields = line.split()
+            latitude_1, longitude_1, latitude_2, longitude_2 = (float(field) for field in fields[:4])
+            distance = Geodesic.WGS84.Inverse(latitude_1, longitude_1, latitude_2, longitude_2, Geodesic.DISTANCE)["s12"]
+            reference.write("{} {:.9f} {}\n".format(" ".join(fields[:4]), distance, fields[5]))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        sys.exit("Usage: geographiclib_reference.py REFERENCE_FILE")
+    main(sys.argv[1])
@@ -0,0 +1,167 @@
+#include "GeoPoint.hpp"
+#include "GeodesicTiered.hpp"
+#include "SpatialIndex.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+//REVIEW - Spatial index regression against brute force
+//NOTE - Usage: geodesic_spatial_index SCRATCH_FILE
+//NOTE - Builds an index, inserts past PENDING_LIMIT so the pending buffer is folded in, erases a third of the points,
+//NOTE - saves it to SCRATCH_FILE, maps it back and erases/inserts on the mapped copy. After every step radius and
+//NOTE - nearest queries must return exactly what scanning every live point with exact_distance_WGS84 returns.
+
+namespace {
+
+  constexpr uint64_t INDEX_SEED{0x1DE7u};
+  constexpr std::size_t INITIAL_POINTS{3000};
+  constexpr std::size_t INSERTED_POINTS{Geodesic::SpatialIndex::PENDING_LIMIT + 500};
+  constexpr std::size_t QUERIES{40};
+  constexpr double MAX_RADIUS{3e6}; //NOTE - meters
+  constexpr std::size_t MAX_NEAREST{16};
+
+  struct Population {
+    std::vector<GeoPoint> points{}; //NOTE - Indexed by id
+    std::vector<bool> alive{};
+  };
+
+  class Checker {
+
+    private:
+      std::mt19937_64 m_engine{INDEX_SEED};
+      std::uniform_real_distribution<double> m_latitude{-90, 90}, m_longitude{-180, 180};
+
+    public:
+      auto random_point() -> GeoPoint {
+        return GeoPoint{m_latitude(m_engine), m_longitude(m_engine)};
+      }
+
+      auto random_id(std::size_t count) -> uint32_t {
+        return static_cast<uint32_t>(m_engine() % count);
+      }
+
+      //NOTE - Returns the number of queries whose hits differ from the brute-force scan
+      auto check(const Geodesic::SpatialIndex &index, const Population &population) -> std::size_t {
+        std::size_t mismatches{0};
+        std::vector<Geodesic::IndexHit> hits{};
+
+        for(std::size_t query = 0; query < QUERIES; ++query) {
+          const GeoPoint center{random_point()};
+          const double radius{std::uniform_real_distribution<double>{0, MAX_RADIUS}(m_engine)};
+          const std::size_t k{1 + static_cast<std::size_t>(m_engine() % MAX_NEAREST)};
+
+          std::vector<uint32_t> expected_ids{};
+          std::vector<double> expected_distances{};
+          for(uint32_t id = 0; id < population.points.size(); ++id) {
+            if(!population.alive[id]) {
+              continue;
+            }
+            const double distance{Geodesic::exact_distance_WGS84(center, population.points[id])};
+            expected_distances.push_back(distance);
+            if(distance <= radius) {
+              expected_ids.push_back(id);
+            }
+          }
+          std::sort(expected_distances.begin(), expected_distances.end());
+
+          index.within_radius(center, radius, hits);
+          std::vector<uint32_t> ids{};
+          for(const Geodesic::IndexHit &hit : hits) {
+            ids.push_back(hit.id);
+          }
+          std::sort(ids.begin(), ids.end());
+          bool matched{ids == expected_ids};
+
+          index.nearest(center, k, hits);
+          matched = matched && hits.size() == std::min(k, expected_distances.size());
+          for(std::size_t i = 0; matched && i < hits.size(); ++i) {
+            matched = hits[i].distance == expected_distances[i];
+          }
+
+          if(!matched) {
+            ++mismatches;
+          }
+        }
+        return mismatches;
+      }
+
+  };
+
+  auto live_count(const Population &population) -> std::size_t {
+    return static_cast<std::size_t>(std::count(population.alive.begin(), population.alive.end(), true));
+  }
+
+  //NOTE - Erases count random ids, erase() must report whether the id was still present
+  auto erase_random(Geodesic::SpatialIndex &index, Population &population, Checker &checker, std::size_t count) -> bool {
+    bool consistent{true};
+    for(std::size_t i = 0; i < count; ++i) {
+      const uint32_t id{checker.random_id(population.points.size())};
+      consistent = (index.erase(id) == population.alive[id]) && consistent;
+      population.alive[id] = false;
+    }
+    return consistent;
+  }
+
+  auto insert_random(Geodesic::SpatialIndex &index, Population &population, Checker &checker, std::size_t count) -> void {
+    for(std::size_t i = 0; i < count; ++i) {
+      const uint32_t id{static_cast<uint32_t>(population.points.size())};
+      population.points.push_back(checker.random_point());
+      population.alive.push_back(true);
+      index.insert(id, population.points.back());
+    }
+  }
+
+  auto report(const char *step, const Geodesic::SpatialIndex &index, const Population &population, Checker &checker, bool consistent) -> bool {
+    const std::size_t mismatches{checker.check(index, population)};
+    const bool ok{consistent && mismatches == 0 && index.size() == live_count(population)};
+    std::printf("  %-26s %6zu points  %zu of %zu queries differ  %s\n", step, index.size(), mismatches, QUERIES, ok ? "ok" : "FAILED");
+    return ok;
+  }
+
+};
+
+auto main(int argc, char **argv) -> decltype(argc) {
+
+  const std::vector<std::string> arguments(argv, argv + argc);
+  if(arguments.size() != 2) {
+    std::cerr << "Usage: geodesic_spatial_index SCRATCH_FILE\n";
+    return 1;
+  }
+
+  Checker checker{};
+  Population population{};
+  for(std::size_t i = 0; i < INITIAL_POINTS; ++i) {
+    population.points.push_back(checker.random_point());
+    population.alive.push_back(true);
+  }
+
+  bool passed{true};
+  std::printf("spatial index against brute force\n");
+
+  Geodesic::SpatialIndex index{population.points.data(), population.points.size()};
+  passed = report("built", index, population, checker, true) && passed;
+
+  insert_random(index, population, checker, INSERTED_POINTS);
+  passed = report("inserted", index, population, checker, true) && passed;
+
+  const bool erased{erase_random(index, population, checker, population.points.size() / 3)};
+  passed = report("erased", index, population, checker, erased) && passed;
+
+  index.save(arguments[1]);
+  Geodesic::SpatialIndex mapped{Geodesic::SpatialIndex::load(arguments[1])};
+  passed = report("saved and mapped", mapped, population, checker, true) && passed;
+
+  const bool mapped_erased{erase_random(mapped, population, checker, 200)};
+  insert_random(mapped, population, checker, 200);
+  passed = report("mapped, erased, inserted", mapped, population, checker, mapped_erased) && passed;
+
+  std::printf("%s\n", passed ? "PASSED" : "FAILED");
+  return passed ? 0 : 1;
+
+}
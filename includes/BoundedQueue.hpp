@@ -0,0 +1,67 @@
+#ifndef BOUNDEDQUEUE_HPP
+#define BOUNDEDQUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+//REVIEW - Blocking queue with a fixed capacity
+//NOTE - push() blocks while the queue is full, pop() blocks while it is empty. After close() pushes are refused and
+//NOTE - pop() drains what is left, then returns false.
+template<typename T>
+class BoundedQueue {
+
+  private:
+    std::mutex m_mutex{};
+    std::condition_variable m_not_empty{}, m_not_full{};
+    std::deque<T> m_items{};
+    std::size_t m_capacity;
+    bool m_closed{false};
+
+  public:
+    explicit BoundedQueue(std::size_t capacity): m_capacity{capacity == 0 ? 1 : capacity} {
+      //TODO - Constructor empty
+    }
+
+    BoundedQueue(const BoundedQueue &other) = delete;
+    BoundedQueue &operator=(const BoundedQueue &other) = delete;
+
+    auto push(T item) -> bool {
+      std::unique_lock<std::mutex> lock{m_mutex};
+      m_not_full.wait(lock, [this] { return m_closed || m_items.size() < m_capacity; });
+      if(m_closed) {
+        return false;
+      }
+      m_items.push_back(std::move(item));
+      lock.unlock();
+      m_not_empty.notify_one();
+      return true;
+    }
+
+    auto pop(T &item) -> bool {
+      std::unique_lock<std::mutex> lock{m_mutex};
+      m_not_empty.wait(lock, [this] { return m_closed || !m_items.empty(); });
+      if(m_items.empty()) {
+        return false;
+      }
+      item = std::move(m_items.front());
+      m_items.pop_front();
+      lock.unlock();
+      m_not_full.notify_one();
+      return true;
+    }
+
+    auto close() -> void {
+      {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_closed = true;
+      }
+      m_not_empty.notify_all();
+      m_not_full.notify_all();
+    }
+
+};
+
+#endif
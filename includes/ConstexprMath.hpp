@@ -0,0 +1,195 @@
+#ifndef CONSTEXPRMATH_HPP
+#define CONSTEXPRMATH_HPP
+
+#include "Geodesic.hpp"
+
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+//REVIEW - Math functions usable in constant expressions
+//NOTE - C++17 <cmath> is not constexpr. Every function here checks whether it is being constant evaluated: at compile
+//NOTE - time it runs a long double series (within a few ulp of <cmath>), at run time it calls <cmath> and costs nothing
+//NOTE - extra. Compilers without an is_constant_evaluated builtin always take the <cmath> path, so constexpr use of the
+//NOTE - solvers needs GCC 9, Clang 9, MSVC 19.25 or a C++20 library.
+namespace Geodesic {
+
+  namespace ConstexprMath {
+
+    constexpr auto is_constant_evaluated() noexcept -> bool {
+#if defined(__cpp_lib_is_constant_evaluated)
+      return std::is_constant_evaluated();
+#elif defined(__GNUC__) || defined(__clang__) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+      return __builtin_is_constant_evaluated();
+#else
+      return false;
+#endif
+    }
+
+    //NOTE - Compile-time series, long double throughout
+    namespace Series {
+
+      constexpr long double HALF_PI{WGS84::PI / 2};
+
+      //NOTE - pi/2 - HALF_PI: the double nearest pi, minus PI, plus pi's residual beyond that double (all exact steps)
+      constexpr long double HALF_PI_LOW{((static_cast<long double>(3.141592653589793) - WGS84::PI) + 1.2246467991473531772e-16L) / 2};
+
+      //NOTE - Taylor series on |x| <= pi/4, the 13th term is already below long double epsilon
+      constexpr auto sin_kernel(long double x) -> long double {
+        const long double x2{x * x};
+        long double term{x}, sum{x};
+        for(int n = 1; n <= 13; ++n) {
+          term *= -x2 / ((2 * n) * (2 * n + 1));
+          sum  += term;
+        }
+        return sum;
+      }
+
+      constexpr auto cos_kernel(long double x) -> long double {
+        const long double x2{x * x};
+        long double term{1}, sum{1};
+        for(int n = 1; n <= 13; ++n) {
+          term *= -x2 / ((2 * n - 1) * (2 * n));
+          sum  += term;
+        }
+        return sum;
+      }
+
+      //NOTE - x = quadrant * pi/2 + remainder with |remainder| <= pi/4, quadrant taken modulo 4. The low part keeps a
+      //NOTE - rounded pi/2 from reducing to exactly zero, cos(90 degrees) is then tiny like <cmath>'s rather than 0.
+      constexpr auto reduce(long double x, long double &remainder) -> int {
+        const long double k{x / HALF_PI};
+        const long long quadrant{(k >= 0) ? static_cast<long long>(k + 0.5L) : -static_cast<long long>(-k + 0.5L)};
+        remainder = (x - static_cast<long double>(quadrant) * HALF_PI) - static_cast<long double>(quadrant) * HALF_PI_LOW;
+        return static_cast<int>(((quadrant % 4) + 4) % 4);
+      }
+
+      constexpr auto sin(long double x) -> long double {
+        long double r{};
+        switch(reduce(x, r)) {
+          case 0:  return sin_kernel(r);
+          case 1:  return cos_kernel(r);
+          case 2:  return -sin_kernel(r);
+          default: return -cos_kernel(r);
+        }
+      }
+
+      constexpr auto cos(long double x) -> long double {
+        long double r{};
+        switch(reduce(x, r)) {
+          case 0:  return cos_kernel(r);
+          case 1:  return -sin_kernel(r);
+          case 2:  return -cos_kernel(r);
+          default: return sin_kernel(r);
+        }
+      }
+
+      //NOTE - Newton's method on the mantissa scaled into [0.25, 1), exact powers of two carry the exponent
+      constexpr auto sqrt(long double x) -> long double {
+        if(x < 0 || x != x) {
+          return std::numeric_limits<long double>::quiet_NaN();
+        }
+        if(x == 0 || x == std::numeric_limits<long double>::infinity()) {
+          return x;
+        }
+        long double scale{1};
+        while(x >= 1) {
+          x     *= 0.25L;
+          scale *= 2;
+        }
+        while(x < 0.25L) {
+          x     *= 4;
+          scale *= 0.5L;
+        }
+        long double root{(x + 1) / 2};
+        for(int i = 0; i < 8; ++i) {
+          root = (root + x / root) / 2;
+        }
+        return root * scale;
+      }
+
+      //NOTE - Two argument halvings atan(x) = 2 atan(x / (1 + sqrt(1 + x^2))) bring |x| under tan(pi/16) for the series
+      constexpr auto atan(long double x) -> long double {
+        if(x < 0) {
+          return -atan(-x);
+        }
+        if(x > 1) {
+          return HALF_PI - atan(1 / x);
+        }
+        for(int i = 0; i < 2; ++i) {
+          x = x / (1 + sqrt(1 + x * x));
+        }
+        const long double x2{x * x};
+        long double power{x}, sum{x};
+        for(int n = 1; n <= 16; ++n) {
+          power *= -x2;
+          sum   += power / (2 * n + 1);
+        }
+        return 4 * sum;
+      }
+
+      constexpr auto atan2(long double y, long double x) -> long double {
+        if(x > 0) {
+          return atan(y / x);
+        }
+        if(x < 0) {
+          return (y >= 0) ? atan(y / x) + WGS84::PI : atan(y / x) - WGS84::PI;
+        }
+        return (y > 0) ? HALF_PI : (y < 0) ? -HALF_PI : 0;
+      }
+
+    };
+
+    template<typename T>
+    constexpr auto abs(T x) -> T {
+      return (x < 0) ? -x : x;
+    }
+
+    //NOTE - Integer powers, at run time through std::pow so results match code written against <cmath>
+    template<typename T>
+    constexpr auto pow(T x, int n) -> T {
+      if(!is_constant_evaluated()) {
+        return static_cast<T>(std::pow(x, n));
+      }
+      T result{1};
+      for(int i = 0; i < n; ++i) {
+        result *= x;
+      }
+      return result;
+    }
+
+    template<typename T>
+    constexpr auto sin(T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::sin(x)) : std::sin(x);
+    }
+
+    template<typename T>
+    constexpr auto cos(T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::cos(x)) : std::cos(x);
+    }
+
+    template<typename T>
+    constexpr auto tan(T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::sin(x) / Series::cos(x)) : std::tan(x);
+    }
+
+    template<typename T>
+    constexpr auto sqrt(T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::sqrt(x)) : std::sqrt(x);
+    }
+
+    template<typename T>
+    constexpr auto atan(T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::atan(x)) : std::atan(x);
+    }
+
+    template<typename T>
+    constexpr auto atan2(T y, T x) -> T {
+      return is_constant_evaluated() ? static_cast<T>(Series::atan2(y, x)) : std::atan2(y, x);
+    }
+
+  };
+
+};
+
+#endif
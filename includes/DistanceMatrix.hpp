@@ -0,0 +1,64 @@
+#ifndef DISTANCEMATRIX_HPP
+#define DISTANCEMATRIX_HPP
+
+#include "GeoPoint.hpp"
+#include "ThreadPool.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace Geodesic {
+
+  enum class MatrixLayout {
+    RowMajor, //NOTE - distance[row * columns + column]
+    Tiled     //NOTE - Each tile_rows x tile_columns tile is contiguous (row-major inside), tiles stored row-major, edge tiles padded
+  };
+
+  struct MatrixOptions {
+    MatrixLayout layout{MatrixLayout::RowMajor};
+    std::size_t  tile_rows{32};     //NOTE - 32 x 512 doubles of output plus 512 prepared destinations stay inside L2
+    std::size_t  tile_columns{512};
+  };
+
+  //NOTE - A range of cells in which at least one pair did not converge, those cells hold NaN. In symmetric mode a solved
+  //NOTE - tile and its mirrored (transposed) range are listed separately, each counting its own NaN cells.
+  struct TileFailure {
+    std::size_t row_begin{}, row_end{}, column_begin{}, column_end{};
+    std::size_t failed_pairs{};
+  };
+
+  struct MatrixReport {
+    std::size_t tiles{};
+    std::size_t failed_pairs{};              //NOTE - NaN cells in the output, mirrored cells included
+    std::vector<TileFailure> failures{};
+  };
+
+  //REVIEW - N x M distance matrix engine
+  //NOTE - Splits the output into tiles and runs them on a work-stealing pool, every tile goes through the prepared
+  //NOTE - Vincenty kernel. The caller supplies the output buffer, sized with buffer_size().
+  class DistanceMatrix {
+
+    private:
+      ThreadPool m_pool;
+      MatrixOptions m_options{};
+
+    public:
+      explicit DistanceMatrix(MatrixOptions options = {}, std::size_t thread_count = 0);
+
+      auto buffer_size(std::size_t rows, std::size_t columns) const -> std::size_t;
+      auto index(std::size_t rows, std::size_t columns, std::size_t row, std::size_t column) const -> std::size_t;
+
+      //NOTE - Full rows x columns matrix from origins to destinations, the same array on both sides switches to symmetric mode
+      auto compute(const GeoPoint *origins, std::size_t rows, const GeoPoint *destinations, std::size_t columns, double *distance) -> MatrixReport;
+
+      //NOTE - Symmetric matrix of one set against itself, only the upper triangle is solved and then mirrored into the lower
+      auto compute(const GeoPoint *points, std::size_t count, double *distance) -> MatrixReport;
+
+      auto options() const -> const MatrixOptions&;
+      auto thread_count() const -> std::size_t;
+
+  };
+
+};
+
+#endif
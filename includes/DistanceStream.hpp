@@ -0,0 +1,42 @@
+#ifndef DISTANCESTREAM_HPP
+#define DISTANCESTREAM_HPP
+
+#include "GeodesicKarney.hpp"
+
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <string>
+
+namespace Geodesic {
+
+  enum class StreamFormat {
+    Csv,   //NOTE - In: "lat1,lon1,lat2,lon2" per line (degrees, blank and '#' lines skipped, the first other line may be a
+           //NOTE - header of four non-numeric fields). Out: meters per line
+    Binary //NOTE - In: packed native-endian doubles lat1, lon1, lat2, lon2. Out: one double in meters per pair
+  };
+
+  struct StreamOptions {
+    StreamFormat format{StreamFormat::Csv};
+    std::size_t  chunk_pairs{16384};  //NOTE - Pairs handed between stages at a time
+    std::size_t  chunks_in_flight{8}; //NOTE - Fixed chunk pool, memory use is bounded by chunk_pairs * chunks_in_flight
+    std::size_t  compute_threads{1};
+
+    InverseSolver  solver{InverseSolver::Vincenty};
+    KarneyAccuracy accuracy{KarneyAccuracy::Micrometre}; //NOTE - Only used by the Karney solver
+  };
+
+  struct StreamReport {
+    std::size_t pairs{};
+    std::size_t failed_pairs{}; //NOTE - Pairs that did not converge (written as nan / NaN)
+  };
+
+  //REVIEW - Streaming distance pipeline
+  //NOTE - parse -> compute -> write stages joined by bounded queues, output keeps the input order.
+  //NOTE - Malformed input throws std::runtime_error naming the offending line (CSV) or byte count (binary).
+  auto stream_distances(const std::string &input_path, std::ostream &output, const StreamOptions &options = {}) -> StreamReport; //NOTE - Memory-mapped input
+  auto stream_distances(std::istream &input, std::ostream &output, const StreamOptions &options = {}) -> StreamReport;
+
+};
+
+#endif
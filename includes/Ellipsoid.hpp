@@ -0,0 +1,61 @@
+#ifndef ELLIPSOID_HPP
+#define ELLIPSOID_HPP
+
+#include "Geodesic.hpp"
+
+//REVIEW - Ellipsoid policies for the templated solvers
+//NOTE - A policy is any type with static constexpr long double a (semi-major axis, meters) and f (flattening):
+//NOTE -   struct Clarke1866Ellipsoid { static constexpr long double a{6378206.4}, f{1.0 / 294.978698214}; };
+//NOTE - EllipsoidConstants derives everything the Vincenty iteration needs from it, in the solver's scalar type.
+namespace Geodesic {
+
+  struct WGS84Ellipsoid {
+    static constexpr long double a{WGS84::EARTH_RADIUS_WGS84};
+    static constexpr long double f{WGS84::FLATTENING_WGS84_ELLIPSOID};
+  };
+
+  struct GRS80Ellipsoid {
+    static constexpr long double a{6378137.0};
+    static constexpr long double f{1.0L / 298.257222101L};
+  };
+
+  //NOTE - With u^2 = cos^2(alpha) e'^2, Vincenty's C, A and B are polynomials in cos^2(alpha). Their coefficients are
+  //NOTE - folded here once per (ellipsoid, scalar type) so the batch kernel is Horner steps on literals, no divisions.
+  //NOTE - The folding rounds differently, vincenty_inverse_WGS84 keeps Vincenty's own expressions to stay bit-identical.
+  template<typename Ellipsoid, typename T>
+  struct EllipsoidConstants {
+
+    static_assert(Ellipsoid::a > 0, "Ellipsoid semi-major axis must be positive");
+    static_assert(Ellipsoid::f >= 0 && Ellipsoid::f < 1, "Ellipsoid flattening must lie in [0, 1)");
+
+    static constexpr long double B_AXIS{Ellipsoid::a * (1 - Ellipsoid::f)};
+    static constexpr long double EP_SQ{(Ellipsoid::a * Ellipsoid::a - B_AXIS * B_AXIS) / (B_AXIS * B_AXIS)};
+
+    static constexpr T a{static_cast<T>(Ellipsoid::a)};
+    static constexpr T f{static_cast<T>(Ellipsoid::f)};
+    static constexpr T b{static_cast<T>(B_AXIS)};                  //NOTE - Semi-minor axis
+    static constexpr T one_minus_f{static_cast<T>(1 - Ellipsoid::f)};
+    static constexpr T second_eccentricity_sq{static_cast<T>(EP_SQ)}; //NOTE - e'^2 = (a^2 - b^2) / b^2
+
+    //NOTE - C = f/16 cos^2(alpha) (4 + f (4 - 3 cos^2(alpha))) = C1 cos^2(alpha) + C2 cos^4(alpha)
+    static constexpr T C1{static_cast<T>(Ellipsoid::f * (1 + Ellipsoid::f) / 4)};
+    static constexpr T C2{static_cast<T>(-3 * Ellipsoid::f * Ellipsoid::f / 16)};
+
+    //NOTE - b A = b (1 + u^2/16384 (4096 + u^2 (-768 + u^2 (320 - 175 u^2)))) = bA0 + bA1 c + ... + bA4 c^4
+    static constexpr T bA0{static_cast<T>(B_AXIS)};
+    static constexpr T bA1{static_cast<T>(B_AXIS * EP_SQ / 4)};
+    static constexpr T bA2{static_cast<T>(B_AXIS * -3 * EP_SQ * EP_SQ / 64)};
+    static constexpr T bA3{static_cast<T>(B_AXIS * 5 * EP_SQ * EP_SQ * EP_SQ / 256)};
+    static constexpr T bA4{static_cast<T>(B_AXIS * -175 * EP_SQ * EP_SQ * EP_SQ * EP_SQ / 16384)};
+
+    //NOTE - B = u^2/1024 (256 + u^2 (-128 + u^2 (74 - 47 u^2))) = B1 c + ... + B4 c^4
+    static constexpr T B1{static_cast<T>(EP_SQ / 4)};
+    static constexpr T B2{static_cast<T>(-EP_SQ * EP_SQ / 8)};
+    static constexpr T B3{static_cast<T>(37 * EP_SQ * EP_SQ * EP_SQ / 512)};
+    static constexpr T B4{static_cast<T>(-47 * EP_SQ * EP_SQ * EP_SQ * EP_SQ / 1024)};
+
+  };
+
+};
+
+#endif
@@ -0,0 +1,43 @@
+#ifndef GEOPOINT_HPP
+#define GEOPOINT_HPP
+
+#include "Geodesic.hpp"
+
+#include <type_traits>
+
+//REVIEW - Bare coordinate the distance engine works on
+//NOTE - Two doubles in degrees, no name and no prebuilt strings, so millions of them pack densely in memory
+struct GeoPoint {
+
+  double latitude{}, longitude{};
+
+  static constexpr auto from_radians(double latitude, double longitude) -> GeoPoint {
+    return GeoPoint{latitude * RADIANS_TO_DEGREES, longitude * RADIANS_TO_DEGREES};
+  }
+
+  constexpr auto latitude_radians() const -> double {
+    return latitude * DEGREES_TO_RADIANS;
+  }
+  constexpr auto longitude_radians() const -> double {
+    return longitude * DEGREES_TO_RADIANS;
+  }
+
+  constexpr auto valid_latitude() const -> bool {
+    return latitude >= -90.0 && latitude <= 90.0;
+  }
+  constexpr auto valid_longitude() const -> bool {
+    return longitude >= -180.0 && longitude <= 180.0;
+  }
+
+  //NOTE - Throws std::invalid_argument, the message is only formatted on the failing path
+  auto validate() const -> void;
+
+  static constexpr double DEGREES_TO_RADIANS{static_cast<double>(WGS84::PI / 180.0L)};
+  static constexpr double RADIANS_TO_DEGREES{static_cast<double>(180.0L / WGS84::PI)};
+
+};
+
+static_assert(sizeof(GeoPoint) == 16, "GeoPoint should stay two packed doubles");
+static_assert(std::is_trivially_copyable<GeoPoint>::value, "GeoPoint should stay trivially copyable");
+
+#endif
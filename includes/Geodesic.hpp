@@ -0,0 +1,27 @@
+#ifndef GEODESIC_HPP
+#define GEODESIC_HPP
+
+namespace WGS84 {
+  constexpr long double PI{3.141592653589793238462643};
+  constexpr long double EARTH_RADIUS_WGS84{6378137.0};                   //NOTE - WGS-84 Ellipsoid Model in meters
+  constexpr long double FLATTENING_WGS84_ELLIPSOID{1.0 / 298.257223563}; //NOTE - Formula for flattening the WGS-84 ellipsoid model
+};
+
+struct GeoPoint;
+
+namespace Geodesic {
+
+  //NOTE - Maximum number of Vincenty iterations before a pair is reported as non-converged (NaN)
+  constexpr unsigned VINCENTY_ITERATION_LIMIT{100};
+
+  auto to_radians(long double degrees) -> long double;
+
+  //NOTE - Scalar reference solver, latitude/longitude in degrees, result in meters (NaN when the iteration does not converge)
+  //NOTE - The <WGS84Ellipsoid, long double> instance of vincenty_inverse (GeodesicVincenty.hpp), used by LocationData::distance_to
+  //NOTE - iterations, when given, receives the number of lambda iterations run (VINCENTY_ITERATION_LIMIT when it did not converge)
+  auto vincenty_inverse_WGS84(long double latitude_1, long double longitude_1, long double latitude_2, long double longitude_2, unsigned *iterations = nullptr) -> long double;
+  auto vincenty_inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, unsigned *iterations = nullptr) -> long double;
+
+};
+
+#endif
@@ -0,0 +1,65 @@
+#ifndef GEODESICBATCH_HPP
+#define GEODESICBATCH_HPP
+
+#include "Ellipsoid.hpp"
+#include "Geodesic.hpp"
+
+#include <cstddef>
+
+namespace Geodesic {
+
+  //NOTE - Instruction set picked at runtime for the batch kernels. Every vector one runs the same lane kernel and
+  //NOTE - returns bit-identical distances, they only differ in vector width.
+  enum class BatchISA {
+    Baseline, //NOTE - 128-bit vectors of the target's baseline ISA (SSE2 on x86-64)
+    AVX2,     //NOTE - 256-bit, 4 double / 8 float lanes
+    AVX512,   //NOTE - 512-bit, 8 double / 16 float lanes
+    Scalar    //NOTE - No vector extensions (MSVC) or GEODESIC_BATCH_SCALAR, one pair at a time through vincenty_inverse
+  };
+
+  auto batch_isa() -> BatchISA;
+  auto batch_isa_name(BatchISA isa) -> const char*;
+
+  //REVIEW - Structure-of-arrays batch distance
+  //NOTE - Latitude/longitude arrays in degrees, distance[i] receives the meters between pair i (NaN when not converged).
+  //NOTE - Every bulk function takes the ellipsoid policy (Ellipsoid.hpp) as a template argument, WGS-84 by default. They
+  //NOTE - are built for WGS84Ellipsoid and GRS80Ellipsoid, GEODESIC_BATCH_INSTANTIATE in GeodesicBatch.cpp adds others.
+  //NOTE - The float variant iterates in single precision, a float ulp at 10,000 km is already a metre. Against Karney
+  //NOTE - over random pairs the median error is 0.6 m, a third of the pairs are off by more than 1 m and the worst by
+  //NOTE - about 8.5 m, use the double variant when metres matter.
+  template<typename Ellipsoid = WGS84Ellipsoid>
+  auto distance_batch(const double *latitude_1, const double *longitude_1, const double *latitude_2, const double *longitude_2, double *distance, std::size_t count) -> void;
+  template<typename Ellipsoid = WGS84Ellipsoid>
+  auto distance_batch(const float *latitude_1, const float *longitude_1, const float *latitude_2, const float *longitude_2, float *distance, std::size_t count) -> void;
+
+  //NOTE - Same kernel reading pairs straight out of two GeoPoint arrays
+  template<typename Ellipsoid = WGS84Ellipsoid>
+  auto distance_batch(const GeoPoint *point_1, const GeoPoint *point_2, double *distance, std::size_t count) -> void;
+
+  //REVIEW - Prepared point
+  //NOTE - Reduced latitude U = atan((1 - f) * tan(latitude)) resolved once into sinU/cosU, longitude kept in radians.
+  //NOTE - Prepare a point once and reuse it for every pair it takes part in. The reduced latitude depends on the
+  //NOTE - flattening, so a prepared point carries its ellipsoid in its type and only pairs with points of the same one.
+  template<typename Ellipsoid>
+  struct BasicPreparedPoint {
+    double sinU{}, cosU{1}, longitude{};
+  };
+
+  using PreparedPoint = BasicPreparedPoint<WGS84Ellipsoid>;
+
+  template<typename Ellipsoid = WGS84Ellipsoid>
+  auto prepare(const GeoPoint &point) -> BasicPreparedPoint<Ellipsoid>;
+  template<typename Ellipsoid>
+  auto prepare(const GeoPoint *points, BasicPreparedPoint<Ellipsoid> *prepared, std::size_t count) -> void;
+
+  //NOTE - distance[i] receives the meters from origin to destinations[i], the caller owns the output buffer
+  template<typename Ellipsoid>
+  auto distance_one_to_many(const BasicPreparedPoint<Ellipsoid> &origin, const BasicPreparedPoint<Ellipsoid> *destinations, std::size_t count, double *distance) -> void;
+
+  //NOTE - Row-major origin_count x destination_count matrix, distance[row * destination_count + column]
+  template<typename Ellipsoid>
+  auto distance_many_to_many(const BasicPreparedPoint<Ellipsoid> *origins, std::size_t origin_count, const BasicPreparedPoint<Ellipsoid> *destinations, std::size_t destination_count, double *distance) -> void;
+
+};
+
+#endif
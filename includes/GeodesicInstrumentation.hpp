@@ -0,0 +1,141 @@
+#ifndef GEODESICINSTRUMENTATION_HPP
+#define GEODESICINSTRUMENTATION_HPP
+
+#include "Geodesic.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#ifdef GEODESIC_INSTRUMENTATION
+  #include <chrono>
+#endif
+
+//REVIEW - Vincenty solver instrumentation
+//NOTE - Built in with -DGEODESIC_INSTRUMENTATION (CMake option GEODESIC_INSTRUMENTATION). Every thread counts into its
+//NOTE - own counters, instrumentation_snapshot() merges them (threads that already exited included) on demand.
+//NOTE - Without the macro the hooks below are empty inline functions and the solvers compile to the same code as before,
+//NOTE - the snapshot is then all zeros with enabled == false.
+namespace Geodesic {
+
+#ifdef GEODESIC_INSTRUMENTATION
+  constexpr bool INSTRUMENTATION_ENABLED{true};
+#else
+  constexpr bool INSTRUMENTATION_ENABLED{false};
+#endif
+
+  constexpr unsigned    LATENCY_SAMPLE_PERIOD{64}; //NOTE - One scalar solve in this many is timed, per thread
+  constexpr std::size_t LATENCY_BUCKETS{24};       //NOTE - Bucket i holds [2^i, 2^(i+1)) ns, the last one is open-ended
+
+  struct LatencySummary {
+    uint64_t samples{}, total_ns{}, max_ns{};
+    std::array<uint64_t, LATENCY_BUCKETS> buckets{};
+  };
+
+  struct InstrumentationSnapshot {
+    bool enabled{INSTRUMENTATION_ENABLED};
+
+    uint64_t calls{};            //NOTE - Pairs solved, scalar and batch
+    uint64_t total_iterations{};
+    uint64_t coincident_exits{};
+    uint64_t equatorial_cases{}; //NOTE - Pairs that finished with cos_sq_alpha == 0
+    uint64_t non_converged{};    //NOTE - Pairs that ran into VINCENTY_ITERATION_LIMIT and came back NaN
+
+    std::array<uint64_t, VINCENTY_ITERATION_LIMIT + 1> iteration_histogram{}; //NOTE - Index VINCENTY_ITERATION_LIMIT are the non-converged pairs
+
+    LatencySummary solve_latency{};      //NOTE - Sampled scalar vincenty_inverse_WGS84 calls
+    LatencySummary batch_pair_latency{}; //NOTE - Every batch call, as nanoseconds per pair
+
+    auto to_json() const -> std::string;
+    auto to_prometheus() const -> std::string; //NOTE - Text exposition format, metrics prefixed geodesic_vincenty_
+  };
+
+  auto instrumentation_snapshot() -> InstrumentationSnapshot;
+  auto reset_instrumentation() -> void; //NOTE - Counts racing with a reset may survive it
+
+  //NOTE - Hooks for the solvers
+  namespace Instrumentation {
+
+    enum class PairOutcome {
+      Converged,
+      Coincident,
+      NonConverged
+    };
+
+#ifdef GEODESIC_INSTRUMENTATION
+
+    auto record_pair(unsigned iterations, PairOutcome outcome, bool equatorial) -> void;
+    auto sample_solve() -> bool;
+    auto record_solve_latency(uint64_t nanoseconds) -> void;
+    auto record_batch_latency(uint64_t nanoseconds, std::size_t pairs) -> void;
+
+    //NOTE - Times the enclosing scalar solve when this thread's sampling countdown runs out
+    class SolveTimer {
+
+      private:
+        bool m_sampled{sample_solve()};
+        std::chrono::steady_clock::time_point m_start{m_sampled ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point{}};
+
+      public:
+        SolveTimer() {
+          //TODO - Constructor empty
+        }
+
+        SolveTimer(const SolveTimer &other) = delete;
+        SolveTimer &operator=(const SolveTimer &other) = delete;
+
+        ~SolveTimer() {
+          if(m_sampled) {
+            record_solve_latency(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()));
+          }
+        }
+
+    };
+
+    class BatchTimer {
+
+      private:
+        std::size_t m_pairs{};
+        std::chrono::steady_clock::time_point m_start{std::chrono::steady_clock::now()};
+
+      public:
+        explicit BatchTimer(std::size_t pairs):
+        m_pairs{pairs} {
+          //TODO - Constructor empty
+        }
+
+        BatchTimer(const BatchTimer &other) = delete;
+        BatchTimer &operator=(const BatchTimer &other) = delete;
+
+        ~BatchTimer() {
+          record_batch_latency(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count()), m_pairs);
+        }
+
+    };
+
+#else
+
+    inline auto record_pair(unsigned, PairOutcome, bool) -> void {}
+
+    class SolveTimer {
+      public:
+        SolveTimer() {
+          //TODO - Constructor empty
+        }
+    };
+
+    class BatchTimer {
+      public:
+        explicit BatchTimer(std::size_t) {
+          //TODO - Constructor empty
+        }
+    };
+
+#endif
+
+  };
+
+};
+
+#endif
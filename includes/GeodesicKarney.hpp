@@ -0,0 +1,33 @@
+#ifndef GEODESICKARNEY_HPP
+#define GEODESICKARNEY_HPP
+
+#include "Geodesic.hpp"
+
+namespace Geodesic {
+
+  //NOTE - Target accuracy of the Karney solver, looser targets stop the Newton iteration earlier
+  enum class KarneyAccuracy {
+    Millimetre, //NOTE - Within 1 mm of Full, about 0.5 mm at worst
+    Micrometre, //NOTE - Within 1 um of Full, about 0.5 um at worst
+    Full        //NOTE - Round-off limited, about 15 nm on WGS-84
+  };
+
+  enum class InverseSolver {
+    Vincenty, //NOTE - Reference solver, NaN for near-antipodal pairs it cannot converge on
+    Karney    //NOTE - Always converges, antipodal pairs included
+  };
+
+  //REVIEW - Karney's inverse solution (C. F. F. Karney, Algorithms for geodesics, J. Geodesy 87, 2013)
+  //NOTE - Newton's method on the azimuth at the first point, started from a spherical or astroid estimate and backed
+  //NOTE - by bisection, with 6th order series in the third flattening. Converges in 2-4 iterations for ordinary pairs
+  //NOTE - and in a bounded number for every pair. Latitude/longitude in degrees, result in meters.
+  //NOTE - iterations (optional) receives the number of Newton/bisection steps taken, 0 when a closed form applied.
+  auto karney_inverse_WGS84(double latitude_1, double longitude_1, double latitude_2, double longitude_2, KarneyAccuracy accuracy = KarneyAccuracy::Micrometre, unsigned *iterations = nullptr) -> double;
+  auto karney_inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, KarneyAccuracy accuracy = KarneyAccuracy::Micrometre, unsigned *iterations = nullptr) -> double;
+
+  //NOTE - Pick the solver at runtime
+  auto inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, InverseSolver solver, KarneyAccuracy accuracy = KarneyAccuracy::Micrometre) -> long double;
+
+};
+
+#endif
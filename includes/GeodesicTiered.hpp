@@ -0,0 +1,52 @@
+#ifndef GEODESICTIERED_HPP
+#define GEODESICTIERED_HPP
+
+#include "GeoPoint.hpp"
+
+#include <cstdint>
+
+namespace Geodesic {
+
+  //REVIEW - Andoyer-Lambert error bound
+  //NOTE - Checked against the Karney solver on 3M pairs (random and short-range): for a central angle of the reduced
+  //NOTE - latitudes up to 90 degrees (~10 000 km) the first-order estimate is off by at most 1.41e-6 of the distance.
+  //NOTE - The bound below adds margin on top of that. Past 90 degrees the error grows to kilometres near the
+  //NOTE - antipode, so the estimate is not trusted there.
+  constexpr double APPROXIMATE_RELATIVE_ERROR{2e-6};
+  constexpr double APPROXIMATE_ABSOLUTE_ERROR{0.01}; //NOTE - meters, covers round-off on very short lines
+  constexpr double APPROXIMATE_MAX_CENTRAL_ANGLE{1.5707963267948966};
+
+  struct DistanceEstimate {
+    double distance{};    //NOTE - meters
+    double error_bound{}; //NOTE - |distance - exact| <= error_bound, infinity when the estimate is not trusted
+  };
+
+  enum class DistanceTier {
+    Auto, //NOTE - Settle with the estimate when the bound allows it, otherwise run the exact solver
+    Exact //NOTE - Always run the exact solver
+  };
+
+  //NOTE - Andoyer-Lambert first-order correction of the great-circle distance on the auxiliary sphere
+  auto approximate_distance_WGS84(const GeoPoint &point_1, const GeoPoint &point_2) -> DistanceEstimate;
+
+  //NOTE - Exact tier, Vincenty with the Karney solver behind it for the pairs Vincenty cannot converge on
+  auto exact_distance_WGS84(const GeoPoint &point_1, const GeoPoint &point_2) -> double;
+
+  //NOTE - distance(point_1, point_2) <= threshold (meters)
+  auto within_distance(const GeoPoint &point_1, const GeoPoint &point_2, double threshold, DistanceTier tier = DistanceTier::Auto) -> bool;
+
+  //SECTION - Counters, kept per thread and summed over every thread (exited ones included) on read
+  struct TierStatistics {
+    uint64_t calls{};
+    uint64_t settled_by_estimate{};
+    uint64_t exact_runs{};
+
+    auto settled_share() const -> double; //NOTE - settled_by_estimate / calls, 0 before the first call
+  };
+
+  auto tier_statistics() -> TierStatistics;
+  auto reset_tier_statistics() -> void;
+
+};
+
+#endif
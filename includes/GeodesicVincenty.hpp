@@ -0,0 +1,169 @@
+#ifndef GEODESICVINCENTY_HPP
+#define GEODESICVINCENTY_HPP
+
+#include "ConstexprMath.hpp"
+#include "Ellipsoid.hpp"
+#include "Geodesic.hpp"
+#include "GeodesicInstrumentation.hpp"
+
+#include <limits>
+#include <type_traits>
+
+namespace Geodesic {
+
+  //NOTE - Convergence tolerance on lambda, shared by vincenty_inverse and the batch kernel. long double keeps the
+  //NOTE - reference solver's epsilon, double and float stop short of their own epsilon, which some pairs never reach.
+  template<typename T> struct VincentyTraits;
+  template<> struct VincentyTraits<float>       { static constexpr float       tolerance{1e-6f}; };
+  template<> struct VincentyTraits<double>      { static constexpr double      tolerance{1e-12}; };
+  template<> struct VincentyTraits<long double> { static constexpr long double tolerance{std::numeric_limits<long double>::epsilon()}; };
+
+  //REVIEW - Vincenty's inverse problem for any ellipsoid policy and scalar type
+  //NOTE - Latitude/longitude in degrees, result in meters, NaN when the iteration does not converge. iterations, when
+  //NOTE - given, receives the number of lambda iterations run (VINCENTY_ITERATION_LIMIT when it did not converge).
+  //NOTE - Usable in constant expressions, e.g. constexpr double d{vincenty_inverse<GRS80Ellipsoid, double>(0, 0, 0, 1)};
+  //NOTE - vincenty_inverse_WGS84 is the <WGS84Ellipsoid, long double> instance. That instance alone keeps the operation
+  //NOTE - order of the original WGS-84 solver, so it returns bit-identical distances and the same NaN pairs, every other
+  //NOTE - instance uses EllipsoidConstants' folded coefficients and multiplies where the original divides.
+  template<typename Ellipsoid, typename T>
+  constexpr auto vincenty_inverse(T latitude_1, T longitude_1, T latitude_2, T longitude_2, unsigned *iterations = nullptr) -> T {
+
+    using K = EllipsoidConstants<Ellipsoid, T>;
+    namespace math = ConstexprMath;
+
+    constexpr bool original_order{std::is_same<Ellipsoid, WGS84Ellipsoid>::value && std::is_same<T, long double>::value};
+
+    constexpr T pi{static_cast<T>(WGS84::PI)};
+    constexpr T f{K::f};                          //NOTE - Flattening of the ellipsoid
+    constexpr T a{K::a};                          //NOTE - Length of semi-major axis of the ellipsoid (radius at equator)
+    constexpr T b{K::b};                          //NOTE - Length of semi-minor axis of the ellipsoid (radius at the poles)
+    constexpr T tolerance{VincentyTraits<T>::tolerance};
+
+    auto radians = [&](T degrees) -> T {
+      if constexpr(original_order) {
+        return degrees * pi / 180;
+      }
+      else {
+        constexpr T degrees_to_radians{static_cast<T>(WGS84::PI / 180.0L)};
+        return degrees * degrees_to_radians;
+      }
+    };
+    auto square = [](T x) -> T {
+      if constexpr(original_order) {
+        return math::pow(x, 2);
+      }
+      else {
+        return x * x;
+      }
+    };
+
+    const T L{radians(longitude_2 - longitude_1)};                          //NOTE - Difference in longitude of the points on the auxiliary sphere
+    const T U1{math::atan((1 - f) * math::tan(radians(latitude_1)))};     //NOTE - Reduced latitude (latitude on the auxiliary sphere)
+    const T U2{math::atan((1 - f) * math::tan(radians(latitude_2)))};     //NOTE - Reduced latitude (latitude on the auxiliary sphere)
+    const T sinU1{math::sin(U1)};
+    const T sinU2{math::sin(U2)};
+    const T cosU1{math::cos(U1)};
+    const T cosU2{math::cos(U2)};
+    T       lambda{L};
+    T       lambda_p{2 * pi};
+
+    T sin_lambda{},
+      cos_lambda{},
+      sin_sigma{},
+      cos_sigma{},
+      sigma{},
+      sin_alpha{},
+      cos_sq_alpha{},
+      cos2_sigma_M{};
+
+    unsigned iteration_limit{VINCENTY_ITERATION_LIMIT};
+
+    while(math::abs(lambda - lambda_p) > tolerance && --iteration_limit > 0) {
+
+      sin_lambda = math::sin(lambda);
+      cos_lambda = math::cos(lambda);
+
+      sin_sigma = math::sqrt(
+        square(cosU2 * sin_lambda) + square(cosU1 * sinU2 - sinU1 * cosU2 * cos_lambda)
+      );
+
+      //REVIEW - Co-incident Points
+      if(sin_sigma == 0) {
+        if(iterations != nullptr) {
+          *iterations = VINCENTY_ITERATION_LIMIT - iteration_limit;
+        }
+        if(!math::is_constant_evaluated()) {
+          Instrumentation::record_pair(VINCENTY_ITERATION_LIMIT - iteration_limit, Instrumentation::PairOutcome::Coincident, false);
+        }
+        return T{0};
+      }
+
+      cos_sigma    = sinU1 * sinU2 + cosU1 * cosU2 * cos_lambda;
+      sigma        = math::atan2(sin_sigma, cos_sigma);
+      sin_alpha    = cosU1 * cosU2 * sin_lambda / sin_sigma;
+      cos_sq_alpha = 1 - square(sin_alpha);
+
+      //REVIEW - Equatorial Line
+      cos2_sigma_M = (cos_sq_alpha == 0) ? T{0} : cos_sigma - 2 * sinU1 * sinU2 / cos_sq_alpha;
+
+      T C{};
+      if constexpr(original_order) {
+        C = f / 16 * cos_sq_alpha * (4 + f * (4 - 3 * cos_sq_alpha));
+      }
+      else {
+        C = cos_sq_alpha * (K::C1 + K::C2 * cos_sq_alpha);
+      }
+      lambda_p = lambda;
+      lambda   = L + (1 - C) * f * sin_alpha * (sigma + C * sin_sigma * (cos2_sigma_M + C * cos_sigma * (-1 + 2 * square(cos2_sigma_M))));
+
+    }
+
+    if(iterations != nullptr) {
+      *iterations = VINCENTY_ITERATION_LIMIT - iteration_limit;
+    }
+    if(!math::is_constant_evaluated()) {
+      Instrumentation::record_pair(
+        VINCENTY_ITERATION_LIMIT - iteration_limit,
+        (iteration_limit == 0) ? Instrumentation::PairOutcome::NonConverged : Instrumentation::PairOutcome::Converged,
+        cos_sq_alpha == 0
+      );
+    }
+
+    if(iteration_limit == 0) {
+      return std::numeric_limits<T>::quiet_NaN();
+    }
+
+    if constexpr(original_order) {
+      const T u_sq{cos_sq_alpha * (a * a - b * b) / (b * b)};
+      const T A{1 + u_sq / 16384 * (4096 + u_sq * (-768 + u_sq * (320 - 175 * u_sq)))};
+      const T B{u_sq / 1024 * (256 + u_sq * (-128 + u_sq * (74 - 47 * u_sq)))};
+      const T delta_sigma{
+        B * sin_sigma * (
+          cos2_sigma_M + B / 4 * (
+            cos_sigma * (-1 + 2 * math::pow(cos2_sigma_M, 2)) - B / 6 * cos2_sigma_M * (-3 + 4 * math::pow(sin_sigma, 2)) * (-3 + 4 * math::pow(cos2_sigma_M, 2))
+          )
+        )
+      };
+
+      return b * A * (sigma - delta_sigma);
+    }
+    else {
+      const T c{cos_sq_alpha};
+      const T bA{K::bA0 + c * (K::bA1 + c * (K::bA2 + c * (K::bA3 + c * K::bA4)))};
+      const T B{c * (K::B1 + c * (K::B2 + c * (K::B3 + c * K::B4)))};
+      const T delta_sigma{
+        B * sin_sigma * (
+          cos2_sigma_M + B * T{0.25} * (
+            cos_sigma * (-1 + 2 * cos2_sigma_M * cos2_sigma_M) - B * static_cast<T>(1.0L / 6) * cos2_sigma_M * (-3 + 4 * sin_sigma * sin_sigma) * (-3 + 4 * cos2_sigma_M * cos2_sigma_M)
+          )
+        )
+      };
+
+      return bA * (sigma - delta_sigma);
+    }
+
+  }
+
+};
+
+#endif
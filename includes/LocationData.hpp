@@ -1,33 +1,22 @@
 #ifndef LOCATIONDATA_HPP
 #define LOCATIONDATA_HPP
 
+#include "GeoPoint.hpp"
+#include "Geodesic.hpp"
+#include "GeodesicTiered.hpp"
+
 #include <cmath>
+#include <cstdint>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
-namespace WGS84 {
-  constexpr long double PI{3.141592653589793238462643};
-  constexpr long double EARTH_RADIUS_WGS84{6378137.0};                   //NOTE - WGS-84 Ellipsoid Model in meters 
-  constexpr long double FLATTENING_WGS84_ELLIPSOID{1.0 / 298.257223563}; //NOTE - Formula for flattening the WGS-84 ellipsoid model
-};
-
 class LocationData {
 
   private:
-    std::string m_location_name{};
-    long double m_latitude{}, m_longitude{};
-
-    const std::string error_location_name{
-      "\nLocationData(!!!INVALID FORMAT/INPUT!!!, " + std::to_string(get_latitude()) + ", " + std::to_string(get_longitude()) + ")\nLocation name should not be empty.\n"
-    };
-    const std::string error_latitude{
-      "\nLocationData(" + get_location_name() + ", !!!INVALID FORMAT/INPUT!!!, " + std::to_string(get_longitude()) + ")\nLatitude value should be within the range of -90 to 90 degrees.\n"
-    };
-    const std::string error_longitude{
-      "\nLocationData(" + get_location_name() + ", " + std::to_string(get_latitude()) + ", !!!INVALID FORMAT/INPUT!!!)\nLongitude value should be within the range of -180 to 180 degrees.\n"
-    };
+    GeoPoint m_point{};
+    uint32_t m_location_name_id{0}; //NOTE - Index into LocationNameTable, 0 is the empty name
 
     auto to_radians(long double degrees) -> long double;
     auto vincenty_algorithm_inverse_geodetic_problem_WGS84(const LocationData &point) -> long double;
@@ -35,6 +24,7 @@ class LocationData {
   public:
     LocationData() = default;
     LocationData(std::string location_name, long double latitude, long double longitude);
+    LocationData(std::string location_name, GeoPoint point);
 
     LocationData(const LocationData &other);
     LocationData(LocationData &&other) noexcept;
@@ -51,9 +41,14 @@ class LocationData {
     auto get_location_name() const -> const std::string&;
     auto get_latitude() const -> const long double;
     auto get_longitude() const -> const long double;
+    auto get_point() const -> const GeoPoint&;
+    auto get_location_name_id() const -> uint32_t;
 
     auto distance_to(const LocationData &point) -> const long double;
 
+    //NOTE - Whether point lies within meters of this location, settled by the cheap estimate whenever its error bound allows
+    auto is_within(const LocationData &point, long double meters, Geodesic::DistanceTier tier = Geodesic::DistanceTier::Auto) const -> bool;
+
     ~LocationData();
 
 };
@@ -0,0 +1,35 @@
+#ifndef LOCATIONNAMETABLE_HPP
+#define LOCATIONNAMETABLE_HPP
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+//REVIEW - Interned location names
+//NOTE - Every distinct name is stored once and referred to by index, id 0 is always the empty name.
+//NOTE - Names are never removed, so the references handed out by name() stay valid for the life of the program.
+class LocationNameTable {
+
+  private:
+    mutable std::mutex m_mutex{};
+    std::deque<std::string> m_names{};
+    std::unordered_map<std::string_view, uint32_t> m_index{};
+
+    LocationNameTable();
+
+  public:
+    LocationNameTable(const LocationNameTable &other) = delete;
+    LocationNameTable &operator=(const LocationNameTable &other) = delete;
+
+    static auto instance() -> LocationNameTable&;
+
+    auto intern(std::string_view name) -> uint32_t;
+    auto name(uint32_t id) const -> const std::string&;
+    auto size() const -> std::size_t;
+
+};
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef MAPPEDFILE_HPP
+#define MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <string>
+
+//REVIEW - Read-only memory-mapped file
+//NOTE - The whole file is mapped at once, pages are only brought in as they are touched
+class MappedFile {
+
+  private:
+    const char *m_data{nullptr};
+    std::size_t m_size{0};
+
+#ifdef _WIN32
+    void *m_file{nullptr}, *m_mapping{nullptr};
+#else
+    int m_descriptor{-1};
+#endif
+
+    auto release() -> void;
+
+  public:
+    explicit MappedFile(const std::string &path);
+
+    MappedFile(const MappedFile &other) = delete;
+    MappedFile &operator=(const MappedFile &other) = delete;
+
+    auto data() const -> const char*;
+    auto size() const -> std::size_t;
+
+    ~MappedFile();
+
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef SPATIALINDEX_HPP
+#define SPATIALINDEX_HPP
+
+#include "GeoPoint.hpp"
+#include "LocationData.hpp"
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Geodesic {
+
+  struct IndexHit {
+    uint32_t id{};
+    double   distance{}; //NOTE - meters, exact
+  };
+
+  //NOTE - One point of the index, the k-d tree lives implicitly in the array order (node = middle of its range)
+  struct IndexEntry {
+    double   ecef[3];   //NOTE - Earth-centred, earth-fixed position on the ellipsoid surface, meters
+    GeoPoint point;
+    uint32_t id;
+    uint8_t  axis;      //NOTE - Splitting axis of the node stored at this slot
+    uint8_t  erased;
+    uint16_t reserved;
+  };
+
+  //REVIEW - 3D ECEF k-d tree over points on the ellipsoid
+  //NOTE - The straight-line (chord) distance between two surface points never exceeds their geodesic distance, so
+  //NOTE - chords and splitting-plane distances prune candidates safely. Only survivors go through the exact solver
+  //NOTE - (Vincenty, Karney when Vincenty does not converge).
+  //NOTE - Entries sit in one flat array that save() writes as is and load() memory-maps back without a rebuild.
+  //NOTE - Inserts collect in a small unsorted buffer and erases leave tombstones, both are folded in by a rebuild once
+  //NOTE - they pile up. Ids are chosen by the caller and must be unique.
+  class SpatialIndex {
+
+    private:
+      const IndexEntry *m_entries{nullptr}; //NOTE - Either m_owned.data() or the mapped file
+      std::size_t m_count{0}, m_erased{0};
+      std::vector<IndexEntry> m_owned{};
+      std::vector<IndexEntry> m_pending{};
+      std::unique_ptr<MappedFile> m_mapping{};
+      std::unordered_map<uint32_t, std::size_t> m_slots{}; //NOTE - id -> tree slot, built on the first erase
+
+      auto rebuild() -> void;
+      auto make_owned() -> void;
+
+      auto search_radius(std::size_t begin, std::size_t end, const double (&center)[3], const GeoPoint &point, double radius, std::vector<IndexHit> &hits) const -> void;
+      auto search_nearest(std::size_t begin, std::size_t end, const double (&center)[3], const GeoPoint &point, std::size_t k, std::vector<IndexHit> &heap) const -> void;
+
+    public:
+      static constexpr std::size_t PENDING_LIMIT{4096}; //NOTE - Inserts buffered before the tree is rebuilt
+
+      SpatialIndex() = default;
+      SpatialIndex(const GeoPoint *points, std::size_t count);                      //NOTE - Ids are the array positions
+      SpatialIndex(const GeoPoint *points, const uint32_t *ids, std::size_t count);
+      SpatialIndex(const LocationData *locations, std::size_t count);               //NOTE - Ids are the array positions
+
+      SpatialIndex(const SpatialIndex &other) = delete;
+      SpatialIndex &operator=(const SpatialIndex &other) = delete;
+      SpatialIndex(SpatialIndex &&other) noexcept = default;
+      SpatialIndex &operator=(SpatialIndex &&other) noexcept = default;
+
+      auto insert(uint32_t id, const GeoPoint &point) -> void;
+      auto erase(uint32_t id) -> bool;
+      auto size() const -> std::size_t;
+
+      //NOTE - Every point within radius meters of center, hits sorted by distance
+      auto within_radius(const GeoPoint &center, double radius, std::vector<IndexHit> &hits) const -> void;
+
+      //NOTE - The k points closest to center, hits sorted by distance
+      auto nearest(const GeoPoint &center, std::size_t k, std::vector<IndexHit> &hits) const -> void;
+
+      //NOTE - Flat native-endian image: header followed by the entry array
+      auto save(const std::string &path) const -> void;
+      static auto load(const std::string &path) -> SpatialIndex;
+
+      static auto to_ecef(const GeoPoint &point, double (&ecef)[3]) -> void;
+
+  };
+
+};
+
+#endif
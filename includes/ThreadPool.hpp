@@ -0,0 +1,54 @@
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//REVIEW - Work-stealing thread pool
+//NOTE - Every worker owns a deque. Submitted tasks are dealt round-robin, a worker pops the newest task of its own
+//NOTE - deque and, once that runs dry, steals the oldest task from the others, so uneven tiles even out by themselves.
+class ThreadPool {
+
+  private:
+    struct WorkQueue {
+      std::mutex mutex{};
+      std::deque<std::function<void()>> tasks{};
+    };
+
+    std::vector<std::unique_ptr<WorkQueue>> m_queues{};
+    std::vector<std::thread> m_threads{};
+
+    std::mutex m_state_mutex{};
+    std::condition_variable m_task_ready{};
+    std::condition_variable m_all_done{};
+    std::size_t m_queued{0}, m_unfinished{0};
+    std::atomic<std::size_t> m_next_queue{0};
+    std::exception_ptr m_failure{}; //NOTE - First exception a task threw since the last wait()
+    bool m_stop{false};
+
+    auto try_pop(std::size_t worker, std::function<void()> &task) -> bool;
+    auto run_worker(std::size_t worker) -> void;
+
+  public:
+    explicit ThreadPool(std::size_t thread_count = 0); //NOTE - 0 uses std::thread::hardware_concurrency()
+
+    ThreadPool(const ThreadPool &other) = delete;
+    ThreadPool &operator=(const ThreadPool &other) = delete;
+
+    auto submit(std::function<void()> task) -> void;
+    auto wait() -> void; //NOTE - Blocks until every submitted task has finished, then rethrows the first exception one threw
+    auto thread_count() const -> std::size_t;
+
+    ~ThreadPool();
+
+};
+
+#endif
@@ -1,9 +1,17 @@
 #include <iostream>
+#include <fstream>
+#include "DistanceStream.hpp"
+#include "GeodesicInstrumentation.hpp"
 #include "LocationData.hpp"
 #include <matplot/matplot.h>
 #include <string>
 #include <vector>
 
+#ifdef _WIN32
+  #include <fcntl.h>
+  #include <io.h>
+#endif
+
 //REVIEW - Vincenty's Formulae Algorithm Inverse Geodetic Problem
 //LINK - https://en.wikipedia.org/wiki/Vincenty%27s_formulae#Inverse_problem
 //LINK - https://community.esri.com/t5/coordinate-reference-systems-blog/distance-on-an-ellipsoid-vincenty-s-formulae/ba-p/902053#:~:text=Vincenty%27s%20formulae%20were%20published%20in%201975,perhaps%2C%20more%20appropriate%20geometry%20to%20use&text=Vincenty%27s%20formulae%20were%20published,appropriate%20geometry%20to%20use&text=were%20published%20in%201975,perhaps%2C%20more%20appropriate%20geometry
@@ -14,27 +22,143 @@
 //REVIEW - Latitude and Longitude of Manila, Philippines
 //LINK - https://www.latlong.net/place/manila-philippines-9339.html
 
+auto print_usage(std::ostream &output) -> void {
+  output << "Usage:\n"
+         << "  launch                 Print the Tokyo, Japan to Manila, Philippines distance\n"
+         << "  launch --plot          Same, and plot/save the route with matplot++\n"
+         << "  launch --stream [--input FILE] [--output FILE] [--format csv|binary] [--chunk PAIRS] [--threads N]\n"
+         << "                 [--solver vincenty|karney] [--accuracy mm|um|full] [--stats json|prometheus]\n"
+         << "                         Read lat1,lon1,lat2,lon2 pairs (stdin or memory-mapped FILE), write distances in meters\n"
+         << "                         --stats dumps the solver counters to stderr (needs a GEODESIC_INSTRUMENTATION build)\n";
+}
+
+auto run_stream(const std::vector<std::string> &arguments) -> int {
+
+  Geodesic::StreamOptions options{};
+  std::string input_path{}, output_path{}, stats_format{};
+
+  for(std::size_t i = 1; i < arguments.size(); ++i) {
+    const std::string &argument{arguments[i]};
+    const bool has_value{i + 1 < arguments.size()};
+
+    if(argument == "--stream") {
+      continue;
+    }
+    if(!has_value) {
+      print_usage(std::cerr);
+      return 1;
+    }
+    const std::string &value{arguments[++i]};
+
+    if(argument == "--input") {
+      input_path = value;
+    }
+    else if(argument == "--output") {
+      output_path = value;
+    }
+    else if(argument == "--format" && (value == "csv" || value == "binary")) {
+      options.format = (value == "binary") ? Geodesic::StreamFormat::Binary : Geodesic::StreamFormat::Csv;
+    }
+    else if(argument == "--chunk") {
+      options.chunk_pairs = std::stoul(value);
+    }
+    else if(argument == "--threads") {
+      options.compute_threads = std::stoul(value);
+    }
+    else if(argument == "--solver" && (value == "vincenty" || value == "karney")) {
+      options.solver = (value == "karney") ? Geodesic::InverseSolver::Karney : Geodesic::InverseSolver::Vincenty;
+    }
+    else if(argument == "--accuracy" && (value == "mm" || value == "um" || value == "full")) {
+      options.accuracy = (value == "mm") ? Geodesic::KarneyAccuracy::Millimetre : (value == "um") ? Geodesic::KarneyAccuracy::Micrometre : Geodesic::KarneyAccuracy::Full;
+    }
+    else if(argument == "--stats" && (value == "json" || value == "prometheus")) {
+      stats_format = value;
+    }
+    else {
+      print_usage(std::cerr);
+      return 1;
+    }
+  }
+
+#ifdef _WIN32
+  if(options.format == Geodesic::StreamFormat::Binary) {
+    _setmode(_fileno(stdin), _O_BINARY);
+    _setmode(_fileno(stdout), _O_BINARY);
+  }
+#endif
+
+  std::ios::sync_with_stdio(false);
+
+  std::ofstream output_file{};
+  if(!output_path.empty()) {
+    output_file.open(output_path, std::ios::binary);
+    if(!output_file) {
+      std::cerr << "Output file could not be opened: " << output_path << "\n";
+      return 1;
+    }
+  }
+  std::ostream &output{output_path.empty() ? std::cout : output_file};
+
+  const Geodesic::StreamReport report{
+    input_path.empty() ? Geodesic::stream_distances(std::cin, output, options) : Geodesic::stream_distances(input_path, output, options)
+  };
+
+  std::cerr << report.pairs << " pairs, " << report.failed_pairs << " did not converge\n";
+
+  if(!stats_format.empty()) {
+    const Geodesic::InstrumentationSnapshot snapshot{Geodesic::instrumentation_snapshot()};
+    std::cerr << ((stats_format == "json") ? snapshot.to_json() : snapshot.to_prometheus());
+  }
+  return 0;
+
+}
+
 auto main(int argc, char **argv) -> decltype(argc) {
 
+  const std::vector<std::string> arguments(argv, argv + argc);
+  bool plot{false};
+
+  for(std::size_t i = 1; i < arguments.size(); ++i) {
+    if(arguments[i] == "--stream") {
+      try {
+        return run_stream(arguments);
+      }
+      catch(const std::exception &error) {
+        std::cerr << error.what();
+        return 1;
+      }
+    }
+    else if(arguments[i] == "--plot") {
+      plot = true;
+    }
+    else {
+      print_usage(std::cerr);
+      return 1;
+    }
+  }
+
   LocationData *japan_capital{new LocationData{"Tokyo, Japan", 35.652832L, 139.839478L}};
   LocationData *philippines_capital{new LocationData{"Manila, Philippines", 14.599512L, 120.984222L}};
 
-  const long double distance{japan_capital->distance_to(*philippines_capital)};
+  const long double distance{japan_capital->distance_to(*philippines_capital)}; //NOTE - distance_to reports megameters (10^6 meters)
+
+  //REVIEW - matplot++ is only touched when the plot is asked for
+  if(plot) {
+    std::vector<long double> japan_philippines_longitude{japan_capital->get_longitude(), philippines_capital->get_longitude()};
+    std::vector<long double> japan_philippines_latitude{japan_capital->get_latitude(), philippines_capital->get_latitude()};
 
-  std::vector<long double> japan_philippines_longitude{japan_capital->get_longitude(), philippines_capital->get_longitude()};
-  std::vector<long double> japan_philippines_latitude{japan_capital->get_latitude(), philippines_capital->get_latitude()};
+    matplot::geoplot(japan_philippines_longitude, japan_philippines_latitude);
+    matplot::hold(matplot::on);
+    matplot::plot(japan_philippines_longitude, japan_philippines_latitude);
+    matplot::title("Tokyo, Japan to Manila, Philippines Approximate Distance: " + std::to_string(distance) + " megameters");
 
-  matplot::geoplot(japan_philippines_longitude, japan_philippines_latitude);
-  matplot::hold(matplot::on);
-  matplot::plot(japan_philippines_longitude, japan_philippines_latitude);
-  matplot::title("Tokyo, Japan to Manila, Philippines Approximate Distance: " + std::to_string(distance) + " meters");
-  
-  matplot::show();
+    matplot::show();
 
-  matplot::save("../data/distance_tokyo_japan_manila_philippines.png");
-  matplot::save("../data/distance_tokyo_japan_manila_philippines.svg");
+    matplot::save("../data/distance_tokyo_japan_manila_philippines.png");
+    matplot::save("../data/distance_tokyo_japan_manila_philippines.svg");
+  }
 
-  std::cout << "Approximate Distance: " << distance << " meters\n";
+  std::cout << "Approximate Distance: " << distance << " megameters\n";
 
   delete japan_capital;
   japan_capital = nullptr;
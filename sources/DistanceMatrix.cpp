@@ -0,0 +1,163 @@
+#include "DistanceMatrix.hpp"
+#include "GeodesicBatch.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+Geodesic::DistanceMatrix::DistanceMatrix(MatrixOptions options, std::size_t thread_count):
+m_pool{thread_count}, m_options{options} {
+  if(options.tile_rows == 0 || options.tile_columns == 0) {
+    throw std::invalid_argument(
+      "\nDistanceMatrix(" + std::to_string(options.tile_rows) + " x " + std::to_string(options.tile_columns) + ")\nTile dimensions should be greater than zero.\n"
+    );
+  }
+}
+
+auto Geodesic::DistanceMatrix::buffer_size(std::size_t rows, std::size_t columns) const -> std::size_t {
+  if(m_options.layout == MatrixLayout::RowMajor) {
+    return rows * columns;
+  }
+  const std::size_t tile_grid_rows{(rows + m_options.tile_rows - 1) / m_options.tile_rows};
+  const std::size_t tile_grid_columns{(columns + m_options.tile_columns - 1) / m_options.tile_columns};
+  return tile_grid_rows * tile_grid_columns * m_options.tile_rows * m_options.tile_columns;
+}
+
+auto Geodesic::DistanceMatrix::index(std::size_t rows, std::size_t columns, std::size_t row, std::size_t column) const -> std::size_t {
+  static_cast<void>(rows);
+  if(m_options.layout == MatrixLayout::RowMajor) {
+    return row * columns + column;
+  }
+  const std::size_t tile_grid_columns{(columns + m_options.tile_columns - 1) / m_options.tile_columns};
+  const std::size_t tile{(row / m_options.tile_rows) * tile_grid_columns + column / m_options.tile_columns};
+  return tile * m_options.tile_rows * m_options.tile_columns + (row % m_options.tile_rows) * m_options.tile_columns + column % m_options.tile_columns;
+}
+
+namespace {
+
+  struct MatrixJob {
+    const Geodesic::DistanceMatrix *matrix;
+    const Geodesic::PreparedPoint *origins, *destinations;
+    std::size_t rows, columns;
+    double *distance;
+    bool symmetric;
+
+    std::mutex report_mutex{};
+    Geodesic::MatrixReport report{};
+
+    //NOTE - One tile, each row segment is contiguous in both layouts so it goes straight to the one-to-many kernel.
+    //NOTE - In symmetric mode a NaN is also mirrored below the diagonal, those cells are reported under the transposed range.
+    auto run_tile(std::size_t row_begin, std::size_t row_end, std::size_t column_begin, std::size_t column_end) -> void {
+      std::size_t failed_pairs{0}, mirrored_failed_pairs{0};
+
+      for(std::size_t row = row_begin; row < row_end; ++row) {
+        std::size_t first_column{column_begin};
+
+        if(symmetric) {
+          if(row >= column_end) {
+            break;
+          }
+          if(row >= column_begin) {
+            distance[matrix->index(rows, columns, row, row)] = 0.0;
+            first_column = row + 1;
+          }
+        }
+        if(first_column >= column_end) {
+          continue;
+        }
+
+        double *segment{distance + matrix->index(rows, columns, row, first_column)};
+        const std::size_t width{column_end - first_column};
+        Geodesic::distance_one_to_many(origins[row], destinations + first_column, width, segment);
+
+        for(std::size_t i = 0; i < width; ++i) {
+          const bool failed{std::isnan(segment[i])};
+          if(failed) {
+            ++failed_pairs;
+          }
+          if(symmetric) {
+            distance[matrix->index(rows, columns, first_column + i, row)] = segment[i];
+            if(failed) {
+              ++mirrored_failed_pairs;
+            }
+          }
+        }
+      }
+
+      if(failed_pairs + mirrored_failed_pairs == 0) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock{report_mutex};
+      report.failed_pairs += failed_pairs + mirrored_failed_pairs;
+
+      const Geodesic::TileFailure upper{row_begin, row_end, column_begin, column_end, failed_pairs};
+      const Geodesic::TileFailure lower{column_begin, column_end, row_begin, row_end, mirrored_failed_pairs};
+      if(mirrored_failed_pairs > 0 && row_begin == column_begin && row_end == column_end) {
+        report.failures.push_back(Geodesic::TileFailure{row_begin, row_end, column_begin, column_end, failed_pairs + mirrored_failed_pairs});
+        return;
+      }
+      report.failures.push_back(upper);
+      if(mirrored_failed_pairs > 0) {
+        report.failures.push_back(lower);
+      }
+    }
+  };
+
+};
+
+auto Geodesic::DistanceMatrix::compute(const GeoPoint *origins, std::size_t rows, const GeoPoint *destinations, std::size_t columns, double *distance) -> MatrixReport {
+
+  //NOTE - In symmetric mode both sides are the same points, prepared once
+  const bool symmetric{origins == destinations && rows == columns};
+  std::vector<PreparedPoint> prepared_origins(rows), prepared_destinations(symmetric ? 0 : columns);
+  prepare(origins, prepared_origins.data(), rows);
+  if(!symmetric) {
+    prepare(destinations, prepared_destinations.data(), columns);
+  }
+
+  MatrixJob job{this, prepared_origins.data(), symmetric ? prepared_origins.data() : prepared_destinations.data(), rows, columns, distance, symmetric};
+
+  for(std::size_t row_begin = 0; row_begin < rows; row_begin += m_options.tile_rows) {
+    const std::size_t row_end{std::min(row_begin + m_options.tile_rows, rows)};
+
+    for(std::size_t column_begin = 0; column_begin < columns; column_begin += m_options.tile_columns) {
+      const std::size_t column_end{std::min(column_begin + m_options.tile_columns, columns)};
+
+      //NOTE - Tiles entirely below the diagonal are filled by the mirror writes of their upper counterpart
+      if(symmetric && row_begin >= column_end) {
+        continue;
+      }
+
+      ++job.report.tiles;
+      m_pool.submit([&job, row_begin, row_end, column_begin, column_end] {
+        job.run_tile(row_begin, row_end, column_begin, column_end);
+      });
+    }
+  }
+
+  m_pool.wait();
+
+  std::sort(job.report.failures.begin(), job.report.failures.end(), [](const TileFailure &lhs, const TileFailure &rhs) {
+    return std::tie(lhs.row_begin, lhs.column_begin) < std::tie(rhs.row_begin, rhs.column_begin);
+  });
+
+  return std::move(job.report);
+}
+
+auto Geodesic::DistanceMatrix::compute(const GeoPoint *points, std::size_t count, double *distance) -> MatrixReport {
+  return compute(points, count, points, count, distance);
+}
+
+auto Geodesic::DistanceMatrix::options() const -> const MatrixOptions& {
+  return m_options;
+}
+
+auto Geodesic::DistanceMatrix::thread_count() const -> std::size_t {
+  return m_pool.thread_count();
+}
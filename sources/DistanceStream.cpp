@@ -0,0 +1,406 @@
+#include "DistanceStream.hpp"
+#include "BoundedQueue.hpp"
+#include "GeodesicBatch.hpp"
+#include "GeodesicKarney.hpp"
+#include "MappedFile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <istream>
+#include <mutex>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace {
+
+  constexpr std::size_t BINARY_PAIR_BYTES{4 * sizeof(double)};
+  constexpr std::size_t STREAM_BUFFER_BYTES{1 << 20};
+
+  struct StreamChunk {
+    std::size_t sequence{};
+    std::size_t count{};
+    std::vector<double> latitude_1{}, longitude_1{}, latitude_2{}, longitude_2{}, distance{};
+  };
+
+  //REVIEW - Bytes waiting to be parsed
+  //NOTE - view() is the unconsumed input currently available, refill() pulls more in and returns false once exhausted
+  class ByteSource {
+    public:
+      virtual auto view() const -> std::string_view = 0;
+      virtual auto consume(std::size_t bytes) -> void = 0;
+      virtual auto refill() -> bool = 0;
+      virtual ~ByteSource() = default;
+  };
+
+  //NOTE - A mapped file is available in full from the start
+  class MappedSource : public ByteSource {
+    private:
+      const char *m_data;
+      std::size_t m_size, m_position{0};
+
+    public:
+      MappedSource(const char *data, std::size_t size): m_data{data}, m_size{size} {
+        //TODO - Constructor empty
+      }
+
+      auto view() const -> std::string_view override {
+        return std::string_view{m_data + m_position, m_size - m_position};
+      }
+      auto consume(std::size_t bytes) -> void override {
+        m_position += bytes;
+      }
+      auto refill() -> bool override {
+        return false;
+      }
+  };
+
+  //NOTE - Fixed window over an istream, the unconsumed tail is moved to the front before each read
+  class StreamSource : public ByteSource {
+    private:
+      std::istream &m_input;
+      std::vector<char> m_buffer;
+      std::size_t m_begin{0}, m_end{0};
+
+    public:
+      explicit StreamSource(std::istream &input): m_input{input}, m_buffer(STREAM_BUFFER_BYTES) {
+        //TODO - Constructor empty
+      }
+
+      auto view() const -> std::string_view override {
+        return std::string_view{m_buffer.data() + m_begin, m_end - m_begin};
+      }
+      auto consume(std::size_t bytes) -> void override {
+        m_begin += bytes;
+      }
+      auto refill() -> bool override {
+        if(m_begin == 0 && m_end == m_buffer.size()) {
+          throw std::runtime_error("\nstream_distances()\nInput line is longer than the " + std::to_string(STREAM_BUFFER_BYTES) + " byte read buffer.\n");
+        }
+        std::memmove(m_buffer.data(), m_buffer.data() + m_begin, m_end - m_begin);
+        m_end  -= m_begin;
+        m_begin = 0;
+
+        m_input.read(m_buffer.data() + m_end, static_cast<std::streamsize>(m_buffer.size() - m_end));
+        const std::size_t read{static_cast<std::size_t>(m_input.gcount())};
+        m_end += read;
+        return read > 0;
+      }
+  };
+
+  [[noreturn]] auto throw_malformed_line(std::size_t line_number, std::string_view line) -> void {
+    throw std::runtime_error(
+      "\nstream_distances(line " + std::to_string(line_number) + ": " + std::string{line} + ")\nExpected \"latitude_1,longitude_1,latitude_2,longitude_2\" in degrees.\n"
+    );
+  }
+
+  auto skip_blanks(const char *first, const char *last) -> const char* {
+    while(first != last && (*first == ' ' || *first == '\t' || *first == '\r')) {
+      ++first;
+    }
+    return first;
+  }
+
+  //NOTE - Four comma separated numbers, false if the line does not have that shape
+  auto parse_csv_line(std::string_view line, double (&values)[4]) -> bool {
+    const char *first{line.data()};
+    const char *last{line.data() + line.size()};
+
+    for(std::size_t field = 0; field < 4; ++field) {
+      first = skip_blanks(first, last);
+      const std::from_chars_result parsed{std::from_chars(first, last, values[field])};
+      if(parsed.ec != std::errc{}) {
+        return false;
+      }
+      first = skip_blanks(parsed.ptr, last);
+      if(field < 3) {
+        if(first == last || *first != ',') {
+          return false;
+        }
+        ++first;
+      }
+    }
+    return first == last;
+  }
+
+  //REVIEW - Column header
+  //NOTE - Four comma separated fields, none of them empty or starting with a number, e.g. "lat1,lon1,lat2,lon2"
+  auto is_csv_header(std::string_view line) -> bool {
+    const char *first{line.data()};
+    const char *last{line.data() + line.size()};
+
+    for(std::size_t field = 0; field < 4; ++field) {
+      const char *end{std::find(first, last, ',')};
+      if((field < 3) == (end == last)) {
+        return false;
+      }
+      first = skip_blanks(first, end);
+      double value{};
+      if(first == end || std::from_chars(first, end, value).ec == std::errc{}) {
+        return false;
+      }
+      first = (end == last) ? last : end + 1;
+    }
+    return true;
+  }
+
+  //NOTE - Where the CSV parser is in the input, kept across chunks
+  struct CsvPosition {
+    std::size_t line_number{0}; //NOTE - Every line read so far, comments and blank lines included
+    bool        seen_record{false};
+  };
+
+  //NOTE - Fills the chunk up to its capacity, returns false once the input is exhausted
+  auto parse_csv(ByteSource &source, StreamChunk &chunk, CsvPosition &position) -> bool {
+    const std::size_t capacity{chunk.distance.size()};
+    chunk.count = 0;
+
+    while(chunk.count < capacity) {
+      std::string_view bytes{source.view()};
+      std::size_t newline{bytes.find('\n')};
+
+      if(newline == std::string_view::npos) {
+        if(source.refill()) {
+          continue;
+        }
+        if(bytes.empty()) {
+          return false;
+        }
+        newline = bytes.size();
+      }
+
+      const std::string_view line{bytes.substr(0, newline)};
+      source.consume(std::min(newline + 1, bytes.size()));
+      ++position.line_number;
+
+      const char *first{skip_blanks(line.data(), line.data() + line.size())};
+      if(first == line.data() + line.size() || *first == '#') {
+        continue;
+      }
+
+      //NOTE - Only the first line that is neither blank nor a comment may be a header
+      const bool first_record{!position.seen_record};
+      position.seen_record = true;
+
+      double values[4]{};
+      if(!parse_csv_line(line, values)) {
+        if(first_record && is_csv_header(line)) {
+          continue;
+        }
+        throw_malformed_line(position.line_number, line);
+      }
+
+      chunk.latitude_1[chunk.count]  = values[0];
+      chunk.longitude_1[chunk.count] = values[1];
+      chunk.latitude_2[chunk.count]  = values[2];
+      chunk.longitude_2[chunk.count] = values[3];
+      ++chunk.count;
+    }
+
+    return true;
+  }
+
+  auto parse_binary(ByteSource &source, StreamChunk &chunk, std::size_t &bytes_read) -> bool {
+    const std::size_t capacity{chunk.distance.size()};
+    chunk.count = 0;
+
+    while(chunk.count < capacity) {
+      std::string_view bytes{source.view()};
+
+      if(bytes.size() < BINARY_PAIR_BYTES) {
+        if(source.refill()) {
+          continue;
+        }
+        if(!bytes.empty()) {
+          throw std::runtime_error(
+            "\nstream_distances(byte " + std::to_string(bytes_read) + ")\nBinary input ends with " + std::to_string(bytes.size()) + " bytes of an incomplete pair.\n"
+          );
+        }
+        return false;
+      }
+
+      const std::size_t pairs{std::min(bytes.size() / BINARY_PAIR_BYTES, capacity - chunk.count)};
+      for(std::size_t i = 0; i < pairs; ++i) {
+        double values[4];
+        std::memcpy(values, bytes.data() + i * BINARY_PAIR_BYTES, BINARY_PAIR_BYTES);
+        chunk.latitude_1[chunk.count]  = values[0];
+        chunk.longitude_1[chunk.count] = values[1];
+        chunk.latitude_2[chunk.count]  = values[2];
+        chunk.longitude_2[chunk.count] = values[3];
+        ++chunk.count;
+      }
+      source.consume(pairs * BINARY_PAIR_BYTES);
+      bytes_read += pairs * BINARY_PAIR_BYTES;
+    }
+
+    return true;
+  }
+
+  auto write_chunk(const StreamChunk &chunk, Geodesic::StreamFormat format, std::string &buffer, std::ostream &output) -> void {
+    if(format == Geodesic::StreamFormat::Binary) {
+      output.write(reinterpret_cast<const char*>(chunk.distance.data()), static_cast<std::streamsize>(chunk.count * sizeof(double)));
+    }
+    else {
+      buffer.clear();
+      char text[64];
+      for(std::size_t i = 0; i < chunk.count; ++i) {
+        const std::to_chars_result written{std::to_chars(text, text + sizeof(text), chunk.distance[i], std::chars_format::fixed, 4)};
+        buffer.append(text, written.ptr);
+        buffer.push_back('\n');
+      }
+      output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+    if(!output) {
+      throw std::runtime_error("\nstream_distances()\nWriting the output failed.\n");
+    }
+  }
+
+  auto run_pipeline(ByteSource &source, std::ostream &output, const Geodesic::StreamOptions &options) -> Geodesic::StreamReport {
+
+    if(options.chunk_pairs == 0 || options.chunks_in_flight == 0 || options.compute_threads == 0) {
+      throw std::invalid_argument("\nstream_distances()\nChunk size, chunks in flight and compute threads should be greater than zero.\n");
+    }
+
+    std::vector<StreamChunk> chunks(options.chunks_in_flight);
+    BoundedQueue<StreamChunk*> free_chunks{options.chunks_in_flight}, parsed{options.chunks_in_flight}, computed{options.chunks_in_flight};
+
+    for(StreamChunk &chunk : chunks) {
+      for(std::vector<double> *column : {&chunk.latitude_1, &chunk.longitude_1, &chunk.latitude_2, &chunk.longitude_2, &chunk.distance}) {
+        column->resize(options.chunk_pairs);
+      }
+      free_chunks.push(&chunk);
+    }
+
+    std::mutex failure_mutex{};
+    std::exception_ptr failure{};
+    auto fail = [&](std::exception_ptr error) -> void {
+      {
+        std::lock_guard<std::mutex> lock{failure_mutex};
+        if(!failure) {
+          failure = error;
+        }
+      }
+      free_chunks.close();
+      parsed.close();
+      computed.close();
+    };
+
+    //SECTION - Parse stage
+    std::thread parser{[&] {
+      try {
+        std::size_t sequence{0}, bytes_read{0};
+        CsvPosition csv_position{};
+        bool more{true};
+        StreamChunk *chunk{nullptr};
+
+        while(more && free_chunks.pop(chunk)) {
+          more = (options.format == Geodesic::StreamFormat::Binary) ? parse_binary(source, *chunk, bytes_read) : parse_csv(source, *chunk, csv_position);
+          if(chunk->count == 0) {
+            break;
+          }
+          chunk->sequence = sequence++;
+          if(!parsed.push(chunk)) {
+            break;
+          }
+        }
+      }
+      catch(...) {
+        fail(std::current_exception());
+      }
+      parsed.close();
+    }};
+
+    //SECTION - Compute stage
+    std::atomic<std::size_t> running{options.compute_threads};
+    std::vector<std::thread> workers{};
+    for(std::size_t i = 0; i < options.compute_threads; ++i) {
+      workers.emplace_back([&] {
+        StreamChunk *chunk{nullptr};
+        while(parsed.pop(chunk)) {
+          if(options.solver == Geodesic::InverseSolver::Karney) {
+            for(std::size_t i = 0; i < chunk->count; ++i) {
+              chunk->distance[i] = Geodesic::karney_inverse_WGS84(
+                chunk->latitude_1[i], chunk->longitude_1[i], chunk->latitude_2[i], chunk->longitude_2[i], options.accuracy
+              );
+            }
+          }
+          else {
+            Geodesic::distance_batch(
+              chunk->latitude_1.data(), chunk->longitude_1.data(), chunk->latitude_2.data(), chunk->longitude_2.data(), chunk->distance.data(), chunk->count
+            );
+          }
+          if(!computed.push(chunk)) {
+            break;
+          }
+        }
+        if(--running == 0) {
+          computed.close();
+        }
+      });
+    }
+
+    //SECTION - Write stage, chunks finishing out of order wait until their predecessors are written
+    Geodesic::StreamReport report{};
+    try {
+      std::string buffer{};
+      std::vector<StreamChunk*> pending{};
+      std::size_t next_sequence{0};
+      StreamChunk *chunk{nullptr};
+
+      while(computed.pop(chunk)) {
+        pending.push_back(chunk);
+
+        auto ready{std::find_if(pending.begin(), pending.end(), [&](const StreamChunk *item) { return item->sequence == next_sequence; })};
+        while(ready != pending.end()) {
+          StreamChunk *current{*ready};
+          pending.erase(ready);
+
+          write_chunk(*current, options.format, buffer, output);
+          report.pairs += current->count;
+          report.failed_pairs += static_cast<std::size_t>(std::count_if(
+            current->distance.begin(), current->distance.begin() + static_cast<std::ptrdiff_t>(current->count), [](double value) { return std::isnan(value); }
+          ));
+
+          ++next_sequence;
+          free_chunks.push(current);
+          ready = std::find_if(pending.begin(), pending.end(), [&](const StreamChunk *item) { return item->sequence == next_sequence; });
+        }
+      }
+      output.flush();
+    }
+    catch(...) {
+      fail(std::current_exception());
+    }
+
+    parser.join();
+    for(std::thread &worker : workers) {
+      worker.join();
+    }
+
+    if(failure) {
+      std::rethrow_exception(failure);
+    }
+    return report;
+  }
+
+};
+
+auto Geodesic::stream_distances(const std::string &input_path, std::ostream &output, const StreamOptions &options) -> StreamReport {
+  const MappedFile file{input_path};
+  MappedSource source{file.data(), file.size()};
+  return run_pipeline(source, output, options);
+}
+
+auto Geodesic::stream_distances(std::istream &input, std::ostream &output, const StreamOptions &options) -> StreamReport {
+  StreamSource source{input};
+  return run_pipeline(source, output, options);
+}
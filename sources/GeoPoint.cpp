@@ -0,0 +1,17 @@
+#include "GeoPoint.hpp"
+
+#include <stdexcept>
+#include <string>
+
+auto GeoPoint::validate() const -> void {
+  if(!valid_latitude()) {
+    throw std::invalid_argument(
+      "\nGeoPoint(!!!INVALID FORMAT/INPUT!!!, " + std::to_string(longitude) + ")\nLatitude value should be within the range of -90 to 90 degrees.\n"
+    );
+  }
+  if(!valid_longitude()) {
+    throw std::invalid_argument(
+      "\nGeoPoint(" + std::to_string(latitude) + ", !!!INVALID FORMAT/INPUT!!!)\nLongitude value should be within the range of -180 to 180 degrees.\n"
+    );
+  }
+}
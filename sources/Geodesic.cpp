@@ -0,0 +1,21 @@
+#include "Geodesic.hpp"
+#include "GeoPoint.hpp"
+#include "GeodesicInstrumentation.hpp"
+#include "GeodesicVincenty.hpp"
+
+//NOTE - Compile-time checks of the templated solver (quarter of the equator, pole to pole)
+static_assert(Geodesic::ConstexprMath::abs(Geodesic::vincenty_inverse<Geodesic::WGS84Ellipsoid, double>(0, 0, 0, 90) - 10018754.1714) < 1e-3, "constexpr Vincenty on the equator");
+static_assert(Geodesic::ConstexprMath::abs(Geodesic::vincenty_inverse<Geodesic::GRS80Ellipsoid, long double>(90, 0, -90, 0) - 20003931.4585L) < 1e-3L, "constexpr Vincenty along a meridian");
+
+auto Geodesic::to_radians(long double degrees) -> long double {
+  return degrees * WGS84::PI / 180.0;
+}
+
+auto Geodesic::vincenty_inverse_WGS84(long double latitude_1, long double longitude_1, long double latitude_2, long double longitude_2, unsigned *iterations) -> long double {
+  const Instrumentation::SolveTimer timer{};
+  return vincenty_inverse<WGS84Ellipsoid, long double>(latitude_1, longitude_1, latitude_2, longitude_2, iterations);
+}
+
+auto Geodesic::vincenty_inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, unsigned *iterations) -> long double {
+  return vincenty_inverse_WGS84(point_1.latitude, point_1.longitude, point_2.latitude, point_2.longitude, iterations);
+}
@@ -0,0 +1,598 @@
+#include "GeodesicBatch.hpp"
+#include "GeoPoint.hpp"
+#include "Ellipsoid.hpp"
+#include "GeodesicInstrumentation.hpp"
+#include "GeodesicVincenty.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+//NOTE - The lane kernel needs the GCC/Clang vector extensions. Other compilers (MSVC), or a build defining
+//NOTE - GEODESIC_BATCH_SCALAR, get the scalar fallback at the end of the anonymous namespace instead.
+#if defined(__GNUC__) && !defined(GEODESIC_BATCH_SCALAR)
+  #define GEODESIC_BATCH_VECTOR 1
+  #define GEODESIC_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+  #define GEODESIC_ALWAYS_INLINE inline
+#endif
+
+//NOTE - GCC on Windows (MinGW-w64) cannot realign the stack past 16 bytes (GCC bug 54412), so the 256/512-bit lane
+//NOTE - vectors the AVX kernels spill would be stored misaligned. It keeps the 128-bit baseline kernel only.
+#if defined(GEODESIC_BATCH_VECTOR) && (defined(__x86_64__) || defined(__i386__)) && !(defined(_WIN32) && !defined(__clang__))
+  #define GEODESIC_BATCH_X86 1
+#endif
+
+namespace {
+
+  //SECTION - Pair sources
+
+  //NOTE - Pairs read from latitude/longitude arrays in degrees, stride is the element step between consecutive
+  //NOTE - coordinates (1 for plain arrays, 2 for GeoPoint arrays)
+  template<typename T>
+  struct PairSource {
+    const T *latitude_1, *longitude_1, *latitude_2, *longitude_2;
+    std::size_t stride;
+  };
+
+  //NOTE - One prepared origin against an array of prepared destinations, nothing left to compute per pair but L
+  template<typename Ellipsoid>
+  struct PreparedSource {
+    using value_type = double;
+
+    Geodesic::BasicPreparedPoint<Ellipsoid> origin;
+    const Geodesic::BasicPreparedPoint<Ellipsoid> *destinations;
+
+    GEODESIC_ALWAYS_INLINE auto load(std::size_t i, double &L, double &sinU1, double &cosU1, double &sinU2, double &cosU2) const -> void {
+      L     = destinations[i].longitude - origin.longitude;
+      sinU1 = origin.sinU;
+      cosU1 = origin.cosU;
+      sinU2 = destinations[i].sinU;
+      cosU2 = destinations[i].cosU;
+    }
+  };
+
+  //REVIEW - Reduced latitude without atan
+  //NOTE - (sinU, cosU) is the normalised ((1 - f) * sin(phi), |cos(phi)|), which equals atan((1 - f) * tan(phi))
+  //NOTE - but stays well defined when a rounded 90 degrees lands just past pi/2 and flips the tangent.
+  template<typename Ellipsoid, typename T>
+  GEODESIC_ALWAYS_INLINE auto reduced_latitude(T phi, T &sinU, T &cosU) -> void {
+    constexpr T one_minus_f{Geodesic::EllipsoidConstants<Ellipsoid, T>::one_minus_f};
+    const T y{one_minus_f * std::sin(phi)};
+    const T x{std::abs(std::cos(phi))};
+    const T h{std::sqrt(x * x + y * y)};
+    sinU = y / h;
+    cosU = x / h;
+  }
+
+#ifdef GEODESIC_BATCH_VECTOR
+
+  //SECTION - Lane vectors
+
+  //REVIEW - W lanes of T as one GCC/Clang vector
+  //NOTE - Arithmetic and comparisons on these compile to packed instructions of whatever ISA the calling kernel is built
+  //NOTE - for (xmm at baseline, ymm under target("avx2"), zmm under target("avx512f")). A comparison yields a mask with
+  //NOTE - all bits set in the lanes where it holds.
+  template<typename T, std::size_t W> struct Simd;
+
+  template<std::size_t W>
+  struct Simd<double, W> {
+    typedef double   vector  __attribute__((vector_size(sizeof(double) * W)));
+    typedef uint64_t uvector __attribute__((vector_size(sizeof(double) * W)));
+
+    static constexpr double   ROUND{0x1.8p52};                 //NOTE - x + ROUND - ROUND rounds to nearest integer
+    static constexpr uint64_t MAGNITUDE{0x7FFFFFFFFFFFFFFF};   //NOTE - Every bit but the sign
+    static constexpr uint64_t RSQRT_SEED{0x5FE6EB50C7B537A9};  //NOTE - 1/sqrt(x) to ~3.5% from the bit pattern
+    static constexpr unsigned RSQRT_STEPS{4};
+    static constexpr double   TINY{0x1p-900}, TINY_SCALE{0x1p1000}, TINY_UNSCALE{0x1p-500};
+  };
+
+  template<std::size_t W>
+  struct Simd<float, W> {
+    typedef float    vector  __attribute__((vector_size(sizeof(float) * W)));
+    typedef uint32_t uvector __attribute__((vector_size(sizeof(float) * W)));
+
+    static constexpr float    ROUND{0x1.8p23f};
+    static constexpr uint32_t MAGNITUDE{0x7FFFFFFF};
+    static constexpr uint32_t RSQRT_SEED{0x5F375A86};
+    static constexpr unsigned RSQRT_STEPS{3};
+    static constexpr float    TINY{0x1p-100f}, TINY_SCALE{0x1p126f}, TINY_UNSCALE{0x1p-63f};
+  };
+
+  template<typename V, typename T>
+  GEODESIC_ALWAYS_INLINE auto splat(T value) -> V {
+    return V{} + value;
+  }
+
+  template<typename V, typename M>
+  GEODESIC_ALWAYS_INLINE auto select(M mask, V if_true, V if_false) -> V {
+    return (V)((mask & (M)if_true) | (~mask & (M)if_false));
+  }
+
+  template<typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto abs(V x) -> V {
+    using S = Simd<T, W>;
+    return (V)((typename S::uvector)x & S::MAGNITUDE);
+  }
+
+  //NOTE - Bit per lane of a mask
+  template<std::size_t W, typename M>
+  GEODESIC_ALWAYS_INLINE auto lane_bits(M mask) -> unsigned {
+    unsigned bits{0};
+    for(std::size_t lane = 0; lane < W; ++lane) {
+      bits |= (mask[lane] != 0 ? 1u : 0u) << lane;
+    }
+    return bits;
+  }
+
+  //SECTION - Lane math
+
+  //NOTE - Cephes coefficients: sin/cos minimax on [-pi/4, pi/4], atan on [0, 0.66] (double, rational) or [0, tan(pi/8)]
+  //NOTE - (float). pi/2 is split in three so the quadrant reduction is exact for |x| well past the 2 pi lambda can reach.
+  template<typename T> struct LaneMath;
+
+  template<>
+  struct LaneMath<double> {
+    static constexpr double PIO2_1{1.57079625129699707031e+0}, PIO2_2{7.54978941586159635336e-8}, PIO2_3{5.39030285815811905290e-15};
+
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto sin_poly(V z) -> V {
+      return ((((1.58962301576546568060e-10 * z - 2.50507477628578072866e-8) * z + 2.75573136213857245213e-6) * z - 1.98412698295895385996e-4) * z + 8.33333333332211858878e-3) * z - 1.66666666666666307295e-1;
+    }
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto cos_poly(V z) -> V {
+      return ((((-1.13585365213876817300e-11 * z + 2.08757008419747316778e-9) * z - 2.75573141792967388112e-7) * z + 2.48015872888517045348e-5) * z - 1.38888888888730564116e-3) * z + 4.16666666666665929218e-2;
+    }
+
+    static constexpr double ATAN_SPLIT{0.66};
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto atan_poly(V z) -> V {
+      const V p{(((-8.750608600031904122785e-1 * z - 1.615753718733365076637e+1) * z - 7.500855792314704667340e+1) * z - 1.228866684490136173410e+2) * z - 6.485021904942025371773e+1};
+      const V q{((((z + 2.485846490142306297962e+1) * z + 1.650270098316988542046e+2) * z + 4.328810604912902668951e+2) * z + 4.853903996359136964868e+2) * z + 1.945506571482613964425e+2};
+      return z * p / q;
+    }
+  };
+
+  template<>
+  struct LaneMath<float> {
+    static constexpr float PIO2_1{1.5703125f}, PIO2_2{4.837512969970703125e-4f}, PIO2_3{7.54978995489188216e-8f};
+
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto sin_poly(V z) -> V {
+      return (-1.9515295891e-4f * z + 8.3321608736e-3f) * z - 1.6666654611e-1f;
+    }
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto cos_poly(V z) -> V {
+      return (2.443315711809948e-5f * z - 1.388731625493765e-3f) * z + 4.166664568298827e-2f;
+    }
+
+    static constexpr float ATAN_SPLIT{0.4142135623730950f};
+    template<typename V>
+    GEODESIC_ALWAYS_INLINE static auto atan_poly(V z) -> V {
+      return (((8.05374449538e-2f * z - 1.38776856032e-1f) * z + 1.99777106478e-1f) * z - 3.33329491539e-1f) * z;
+    }
+  };
+
+  template<typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto round_nearest(V x) -> V {
+    return (x + Simd<T, W>::ROUND) - Simd<T, W>::ROUND;
+  }
+
+  template<typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto sincos(V x, V &sin_x, V &cos_x) -> void {
+    using M = LaneMath<T>;
+    constexpr T two_over_pi{static_cast<T>(2 / WGS84::PI)};
+
+    const V q{round_nearest<T, W>(x * two_over_pi)};
+    const V r{((x - q * M::PIO2_1) - q * M::PIO2_2) - q * M::PIO2_3};
+    const V quadrant{q - 4 * round_nearest<T, W>((q - T{1.5}) * T{0.25})}; //NOTE - q mod 4, in 0..3
+
+    const V z{r * r};
+    const V s{r + r * z * M::sin_poly(z)};
+    const V c{1 - T{0.5} * z + z * z * M::cos_poly(z)};
+
+    const auto odd{(quadrant == 1) | (quadrant == 3)};
+    const V s0{select(odd, c, s)};
+    const V c0{select(odd, s, c)};
+    sin_x = select(quadrant >= 2, -s0, s0);
+    cos_x = select((quadrant == 1) | (quadrant == 2), -c0, c0);
+  }
+
+  //NOTE - Reduced to atan(t), t in [0, 1], by swapping to the smaller ratio, then once more around pi/4
+  template<typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto atan2(V y, V x) -> V {
+    using M = LaneMath<T>;
+    constexpr T pi{static_cast<T>(WGS84::PI)};
+
+    const V ax{abs<T, W>(x)};
+    const V ay{abs<T, W>(y)};
+    const auto swap{ay > ax};
+    const V numerator{select(swap, ax, ay)};
+    const V denominator{select(swap, ay, ax)};
+    const V t{select(denominator == 0, V{}, numerator / denominator)};
+
+    const auto upper{t > M::ATAN_SPLIT};
+    const V u{select(upper, (t - 1) / (t + 1), t)};
+    V angle{select(upper, splat<V>(pi / 4), V{}) + (u + u * M::atan_poly(u * u))};
+
+    angle = select(swap, pi / 2 - angle, angle);
+    angle = select(x < 0, pi - angle, angle);
+    return select(y < 0, -angle, angle);
+  }
+
+  //NOTE - x * 1/sqrt(x) by Newton steps from a bit-pattern seed, then one correction on the root itself. Stays exact
+  //NOTE - at x = 0 and uses only add/mul, so every ISA rounds it identically. The seed reads the exponent bits, which a
+  //NOTE - subnormal x does not have, so x below TINY is scaled up by an even power of two and the root scaled back.
+  template<typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto sqrt(V x) -> V {
+    using S = Simd<T, W>;
+    using U = typename S::uvector;
+    const auto tiny{x < S::TINY};
+    const V scaled{select(tiny, x * S::TINY_SCALE, x)};
+    V r{(V)(S::RSQRT_SEED - ((U)scaled >> 1))};
+    const V half_x{T{0.5} * scaled};
+    for(unsigned step = 0; step < S::RSQRT_STEPS; ++step) {
+      r = r * (T{1.5} - half_x * r * r);
+    }
+    const V root{scaled * r};
+    const V corrected{root + T{0.5} * r * (scaled - root * root)};
+    return select(tiny, corrected * S::TINY_UNSCALE, corrected);
+  }
+
+  template<typename Ellipsoid, typename T, std::size_t W, typename V = typename Simd<T, W>::vector>
+  GEODESIC_ALWAYS_INLINE auto reduced_latitude(V phi, V &sinU, V &cosU) -> void {
+    constexpr T one_minus_f{Geodesic::EllipsoidConstants<Ellipsoid, T>::one_minus_f};
+    V sin_phi, cos_phi;
+    sincos<T, W>(phi, sin_phi, cos_phi);
+    const V y{one_minus_f * sin_phi};
+    const V x{abs<T, W>(cos_phi)};
+    const V h{sqrt<T, W>(x * x + y * y)};
+    sinU = y / h;
+    cosU = x / h;
+  }
+
+  //SECTION - Staging
+
+  //NOTE - A block of pairs already reduced to L and (sinU, cosU) on both ends
+  constexpr std::size_t STAGE_BLOCK{256};
+
+  template<typename T>
+  struct StagedSource {
+    using value_type = T;
+
+    T L[STAGE_BLOCK], sinU1[STAGE_BLOCK], cosU1[STAGE_BLOCK], sinU2[STAGE_BLOCK], cosU2[STAGE_BLOCK];
+
+    GEODESIC_ALWAYS_INLINE auto load(std::size_t i, T &L_i, T &sinU1_i, T &cosU1_i, T &sinU2_i, T &cosU2_i) const -> void {
+      L_i     = L[i];
+      sinU1_i = sinU1[i];
+      cosU1_i = cosU1[i];
+      sinU2_i = sinU2[i];
+      cosU2_i = cosU2[i];
+    }
+  };
+
+  //NOTE - Degrees to the staged form W pairs at a time, lanes past count are computed on zeros and dropped
+  template<typename Ellipsoid, std::size_t W, typename T>
+  GEODESIC_ALWAYS_INLINE auto stage(const PairSource<T> &pairs, std::size_t begin, std::size_t count, StagedSource<T> &staged) -> void {
+    using V = typename Simd<T, W>::vector;
+    constexpr T degrees_to_radians{static_cast<T>(WGS84::PI / 180.0L)};
+
+    for(std::size_t i = 0; i < count; i += W) {
+      V latitude_1{}, longitude_1{}, latitude_2{}, longitude_2{};
+      for(std::size_t lane = 0; lane < W && i + lane < count; ++lane) {
+        const std::size_t offset{(begin + i + lane) * pairs.stride};
+        latitude_1[lane]  = pairs.latitude_1[offset];
+        longitude_1[lane] = pairs.longitude_1[offset];
+        latitude_2[lane]  = pairs.latitude_2[offset];
+        longitude_2[lane] = pairs.longitude_2[offset];
+      }
+
+      V sinU1, cosU1, sinU2, cosU2;
+      const V L{(longitude_2 - longitude_1) * degrees_to_radians};
+      reduced_latitude<Ellipsoid, T, W>(latitude_1 * degrees_to_radians, sinU1, cosU1);
+      reduced_latitude<Ellipsoid, T, W>(latitude_2 * degrees_to_radians, sinU2, cosU2);
+
+      for(std::size_t lane = 0; lane < W && i + lane < count; ++lane) {
+        staged.L[i + lane]     = L[lane];
+        staged.sinU1[i + lane] = sinU1[lane];
+        staged.cosU1[i + lane] = cosU1[lane];
+        staged.sinU2[i + lane] = sinU2[lane];
+        staged.cosU2[i + lane] = cosU2[lane];
+      }
+    }
+  }
+
+  //SECTION - Kernel
+
+  //REVIEW - Lane-blocked Vincenty iteration
+  //NOTE - W pairs are iterated side by side as one vector. Retiring is a compare mask (coincident, converged or out of
+  //NOTE - iterations), a retired lane is written out and immediately refilled with the next pending pair, so a slow pair
+  //NOTE - never holds up the rest of the batch. Idle lanes keep iterating on a harmless pair and are masked off.
+  template<typename Ellipsoid, std::size_t W, typename Source, typename T = typename Source::value_type>
+  GEODESIC_ALWAYS_INLINE auto vincenty_lanes(const Source &source, T *distance, std::size_t count) -> void {
+
+    using V = typename Simd<T, W>::vector;
+    using K = Geodesic::EllipsoidConstants<Ellipsoid, T>;
+    constexpr T tolerance{Geodesic::VincentyTraits<T>::tolerance};
+    constexpr T last_iteration{static_cast<T>(Geodesic::VINCENTY_ITERATION_LIMIT - 1)};
+
+    std::size_t index[W]{};
+    unsigned    active{0}; //NOTE - Bit per lane holding a pending pair
+    std::size_t next{0};
+
+    V L{}, sinU1{}, cosU1{splat<V>(T{1})}, sinU2{}, cosU2{splat<V>(T{1})}, lambda{}, iterations{};
+
+    auto load = [&](std::size_t lane) -> void {
+      T L_i{0}, sinU1_i{0}, cosU1_i{1}, sinU2_i{0}, cosU2_i{1};
+      if(next == count) {
+        active &= ~(1u << lane);
+      }
+      else {
+        index[lane] = next;
+        source.load(next++, L_i, sinU1_i, cosU1_i, sinU2_i, cosU2_i);
+        active |= 1u << lane;
+      }
+      L[lane]          = L_i;
+      lambda[lane]     = L_i;
+      sinU1[lane]      = sinU1_i;
+      cosU1[lane]      = cosU1_i;
+      sinU2[lane]      = sinU2_i;
+      cosU2[lane]      = cosU2_i;
+      iterations[lane] = 0;
+    };
+
+    for(std::size_t lane = 0; lane < W; ++lane) {
+      load(lane);
+    }
+
+    while(active != 0) {
+
+      V sin_lambda, cos_lambda;
+      sincos<T, W>(lambda, sin_lambda, cos_lambda);
+
+      const V x{cosU2 * sin_lambda};
+      const V y{cosU1 * sinU2 - sinU1 * cosU2 * cos_lambda};
+      const V sin_sigma{sqrt<T, W>(x * x + y * y)};
+      const V cos_sigma{sinU1 * sinU2 + cosU1 * cosU2 * cos_lambda};
+      const V sigma{atan2<T, W>(sin_sigma, cos_sigma)};
+
+      //REVIEW - Co-incident Points
+      const auto coincident{sin_sigma == 0};
+      const V sin_alpha{select(coincident, V{}, cosU1 * cosU2 * sin_lambda / sin_sigma)};
+      const V cos_sq_alpha{1 - sin_alpha * sin_alpha};
+
+      //REVIEW - Equatorial Line
+      const auto equatorial{cos_sq_alpha == 0};
+      const V cos2_sigma_M{select(equatorial, V{}, cos_sigma - 2 * sinU1 * sinU2 / cos_sq_alpha)};
+
+      const V C{cos_sq_alpha * (K::C1 + K::C2 * cos_sq_alpha)};
+      const V lambda_next{L + (1 - C) * K::f * sin_alpha * (sigma + C * sin_sigma * (cos2_sigma_M + C * cos_sigma * (-1 + 2 * cos2_sigma_M * cos2_sigma_M)))};
+      const auto converged{abs<T, W>(lambda_next - lambda) <= tolerance};
+      lambda     = lambda_next;
+      iterations = iterations + 1;
+
+      const unsigned retired{lane_bits<W>(coincident | converged | (iterations >= last_iteration)) & active};
+      if(retired == 0) {
+        continue;
+      }
+
+      const V c{cos_sq_alpha};
+      const V bA{K::bA0 + c * (K::bA1 + c * (K::bA2 + c * (K::bA3 + c * K::bA4)))};
+      const V B{c * (K::B1 + c * (K::B2 + c * (K::B3 + c * K::B4)))};
+      const V delta_sigma{
+        B * sin_sigma * (
+          cos2_sigma_M + B * T{0.25} * (
+            cos_sigma * (-1 + 2 * cos2_sigma_M * cos2_sigma_M) - B * static_cast<T>(1.0L / 6) * cos2_sigma_M * (-3 + 4 * sin_sigma * sin_sigma) * (-3 + 4 * cos2_sigma_M * cos2_sigma_M)
+          )
+        )
+      };
+      const V solved{bA * (sigma - delta_sigma)};
+
+      for(std::size_t lane = 0; lane < W; ++lane) {
+        if((retired & (1u << lane)) == 0) {
+          continue;
+        }
+        if(coincident[lane]) {
+          distance[index[lane]] = 0;
+          Geodesic::Instrumentation::record_pair(static_cast<unsigned>(iterations[lane]), Geodesic::Instrumentation::PairOutcome::Coincident, false);
+        }
+        else if(converged[lane]) {
+          distance[index[lane]] = solved[lane];
+          Geodesic::Instrumentation::record_pair(static_cast<unsigned>(iterations[lane]), Geodesic::Instrumentation::PairOutcome::Converged, equatorial[lane] != 0);
+        }
+        else {
+          distance[index[lane]] = std::numeric_limits<T>::quiet_NaN();
+          Geodesic::Instrumentation::record_pair(Geodesic::VINCENTY_ITERATION_LIMIT, Geodesic::Instrumentation::PairOutcome::NonConverged, equatorial[lane] != 0);
+        }
+        load(lane);
+      }
+
+    }
+
+  }
+
+  //NOTE - Plain pairs are staged a block at a time, the block fits in L1 next to the lane state
+  template<typename Ellipsoid, std::size_t W, typename T>
+  GEODESIC_ALWAYS_INLINE auto vincenty_lanes(const PairSource<T> &pairs, T *distance, std::size_t count) -> void {
+    StagedSource<T> staged;
+    for(std::size_t begin = 0; begin < count; begin += STAGE_BLOCK) {
+      const std::size_t block{std::min(STAGE_BLOCK, count - begin)};
+      stage<Ellipsoid, W>(pairs, begin, block, staged);
+      vincenty_lanes<Ellipsoid, W>(staged, distance + begin, block);
+    }
+  }
+
+  //NOTE - Every path below instantiates the same kernel, only the vector width and the instruction set it is compiled
+  //NOTE - for differ. GeodesicBatch.cpp is built with -ffp-contract=off, so no path fuses a multiply-add the others
+  //NOTE - round twice, and all of them return bit-identical distances.
+  template<typename Ellipsoid, typename Source, typename T>
+  auto baseline_batch(const Source &source, T *distance, std::size_t count) -> void {
+    vincenty_lanes<Ellipsoid, 16 / sizeof(T)>(source, distance, count);
+  }
+
+  #ifdef GEODESIC_BATCH_X86
+
+  template<typename Ellipsoid, typename Source, typename T>
+  __attribute__((target("avx2")))
+  auto avx2_batch(const Source &source, T *distance, std::size_t count) -> void {
+    vincenty_lanes<Ellipsoid, 32 / sizeof(T)>(source, distance, count);
+  }
+
+  template<typename Ellipsoid, typename Source, typename T>
+  __attribute__((target("avx512f,avx512dq")))
+  auto avx512_batch(const Source &source, T *distance, std::size_t count) -> void {
+    vincenty_lanes<Ellipsoid, 64 / sizeof(T)>(source, distance, count);
+  }
+
+  #endif
+
+#else
+
+  //SECTION - Scalar fallback
+
+  //REVIEW - One pair at a time through vincenty_inverse
+  //NOTE - Pairs go through the long double solver, so WGS-84 pairs return what vincenty_inverse_WGS84 returns. A
+  //NOTE - prepared point only keeps (sinU, cosU), its latitude is recovered as atan2(sinU, (1 - f) * cosU).
+  template<typename Ellipsoid, typename T>
+  auto scalar_batch(const PairSource<T> &pairs, T *distance, std::size_t count) -> void {
+    for(std::size_t i = 0; i < count; ++i) {
+      const std::size_t offset{i * pairs.stride};
+      distance[i] = static_cast<T>(Geodesic::vincenty_inverse<Ellipsoid, long double>(
+        pairs.latitude_1[offset], pairs.longitude_1[offset], pairs.latitude_2[offset], pairs.longitude_2[offset]
+      ));
+    }
+  }
+
+  template<typename Ellipsoid>
+  auto scalar_batch(const PreparedSource<Ellipsoid> &source, double *distance, std::size_t count) -> void {
+    constexpr long double one_minus_f{Geodesic::EllipsoidConstants<Ellipsoid, long double>::one_minus_f};
+    constexpr long double radians_to_degrees{180 / WGS84::PI};
+
+    auto latitude = [&](const Geodesic::BasicPreparedPoint<Ellipsoid> &point) -> long double {
+      return std::atan2(static_cast<long double>(point.sinU), one_minus_f * point.cosU) * radians_to_degrees;
+    };
+
+    const long double latitude_1{latitude(source.origin)};
+    const long double longitude_1{source.origin.longitude * radians_to_degrees};
+    for(std::size_t i = 0; i < count; ++i) {
+      distance[i] = static_cast<double>(Geodesic::vincenty_inverse<Ellipsoid, long double>(
+        latitude_1, longitude_1, latitude(source.destinations[i]), source.destinations[i].longitude * radians_to_degrees
+      ));
+    }
+  }
+
+#endif
+
+  auto detect_batch_isa() -> Geodesic::BatchISA {
+#ifndef GEODESIC_BATCH_VECTOR
+    return Geodesic::BatchISA::Scalar;
+#else
+  #ifdef GEODESIC_BATCH_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq")) {
+      return Geodesic::BatchISA::AVX512;
+    }
+    if(__builtin_cpu_supports("avx2")) {
+      return Geodesic::BatchISA::AVX2;
+    }
+  #endif
+    return Geodesic::BatchISA::Baseline;
+#endif
+  }
+
+  template<typename Ellipsoid, typename Source, typename T>
+  auto dispatch_batch(const Source &source, T *distance, std::size_t count) -> void {
+    const Geodesic::Instrumentation::BatchTimer timer{count};
+#ifndef GEODESIC_BATCH_VECTOR
+    scalar_batch<Ellipsoid>(source, distance, count);
+#else
+    switch(Geodesic::batch_isa()) {
+  #ifdef GEODESIC_BATCH_X86
+      case Geodesic::BatchISA::AVX512:
+        avx512_batch<Ellipsoid>(source, distance, count);
+        return;
+      case Geodesic::BatchISA::AVX2:
+        avx2_batch<Ellipsoid>(source, distance, count);
+        return;
+  #endif
+      default:
+        baseline_batch<Ellipsoid>(source, distance, count);
+        return;
+    }
+#endif
+  }
+
+};
+
+auto Geodesic::batch_isa() -> BatchISA {
+  static const BatchISA isa{detect_batch_isa()};
+  return isa;
+}
+
+auto Geodesic::batch_isa_name(BatchISA isa) -> const char* {
+  switch(isa) {
+    case BatchISA::AVX512: return "avx512";
+    case BatchISA::AVX2:   return "avx2";
+    case BatchISA::Scalar: return "scalar";
+    default:               return "baseline";
+  }
+}
+
+template<typename Ellipsoid>
+auto Geodesic::distance_batch(const double *latitude_1, const double *longitude_1, const double *latitude_2, const double *longitude_2, double *distance, std::size_t count) -> void {
+  dispatch_batch<Ellipsoid>(PairSource<double>{latitude_1, longitude_1, latitude_2, longitude_2, 1}, distance, count);
+}
+
+template<typename Ellipsoid>
+auto Geodesic::distance_batch(const float *latitude_1, const float *longitude_1, const float *latitude_2, const float *longitude_2, float *distance, std::size_t count) -> void {
+  dispatch_batch<Ellipsoid>(PairSource<float>{latitude_1, longitude_1, latitude_2, longitude_2, 1}, distance, count);
+}
+
+template<typename Ellipsoid>
+auto Geodesic::distance_batch(const GeoPoint *point_1, const GeoPoint *point_2, double *distance, std::size_t count) -> void {
+  static_assert(sizeof(GeoPoint) == 2 * sizeof(double), "GeoPoint must be two packed doubles");
+  dispatch_batch<Ellipsoid>(PairSource<double>{&point_1->latitude, &point_1->longitude, &point_2->latitude, &point_2->longitude, 2}, distance, count);
+}
+
+template<typename Ellipsoid>
+auto Geodesic::prepare(const GeoPoint &point) -> BasicPreparedPoint<Ellipsoid> {
+  BasicPreparedPoint<Ellipsoid> prepared{};
+  reduced_latitude<Ellipsoid>(point.latitude_radians(), prepared.sinU, prepared.cosU);
+  prepared.longitude = point.longitude_radians();
+  return prepared;
+}
+
+template<typename Ellipsoid>
+auto Geodesic::prepare(const GeoPoint *points, BasicPreparedPoint<Ellipsoid> *prepared, std::size_t count) -> void {
+  for(std::size_t i = 0; i < count; ++i) {
+    prepared[i] = prepare<Ellipsoid>(points[i]);
+  }
+}
+
+template<typename Ellipsoid>
+auto Geodesic::distance_one_to_many(const BasicPreparedPoint<Ellipsoid> &origin, const BasicPreparedPoint<Ellipsoid> *destinations, std::size_t count, double *distance) -> void {
+  dispatch_batch<Ellipsoid>(PreparedSource<Ellipsoid>{origin, destinations}, distance, count);
+}
+
+template<typename Ellipsoid>
+auto Geodesic::distance_many_to_many(const BasicPreparedPoint<Ellipsoid> *origins, std::size_t origin_count, const BasicPreparedPoint<Ellipsoid> *destinations, std::size_t destination_count, double *distance) -> void {
+  for(std::size_t row = 0; row < origin_count; ++row) {
+    distance_one_to_many(origins[row], destinations, destination_count, distance + row * destination_count);
+  }
+}
+
+//REVIEW - Ellipsoids the bulk API is built for
+//NOTE - The kernels stay in this file, so every policy used with them needs its line here
+#define GEODESIC_BATCH_INSTANTIATE(Ellipsoid)                                                                                                                         \
+  template auto Geodesic::distance_batch<Ellipsoid>(const double*, const double*, const double*, const double*, double*, std::size_t) -> void;                        \
+  template auto Geodesic::distance_batch<Ellipsoid>(const float*, const float*, const float*, const float*, float*, std::size_t) -> void;                              \
+  template auto Geodesic::distance_batch<Ellipsoid>(const GeoPoint*, const GeoPoint*, double*, std::size_t) -> void;                                                  \
+  template auto Geodesic::prepare<Ellipsoid>(const GeoPoint&) -> BasicPreparedPoint<Ellipsoid>;                                                                       \
+  template auto Geodesic::prepare<Ellipsoid>(const GeoPoint*, BasicPreparedPoint<Ellipsoid>*, std::size_t) -> void;                                                  \
+  template auto Geodesic::distance_one_to_many<Ellipsoid>(const BasicPreparedPoint<Ellipsoid>&, const BasicPreparedPoint<Ellipsoid>*, std::size_t, double*) -> void; \
+  template auto Geodesic::distance_many_to_many<Ellipsoid>(const BasicPreparedPoint<Ellipsoid>*, std::size_t, const BasicPreparedPoint<Ellipsoid>*, std::size_t, double*) -> void;
+
+GEODESIC_BATCH_INSTANTIATE(Geodesic::WGS84Ellipsoid)
+GEODESIC_BATCH_INSTANTIATE(Geodesic::GRS80Ellipsoid)
@@ -0,0 +1,304 @@
+#include "GeodesicInstrumentation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+  auto latency_json(std::ostringstream &output, const Geodesic::LatencySummary &latency) -> void {
+    output << "{\"samples\":" << latency.samples << ",\"total_ns\":" << latency.total_ns << ",\"max_ns\":" << latency.max_ns << ",\"log2_ns_buckets\":[";
+    for(std::size_t i = 0; i < latency.buckets.size(); ++i) {
+      output << (i ? "," : "") << latency.buckets[i];
+    }
+    output << "]}";
+  }
+
+  //NOTE - Cumulative buckets with upper bounds 2^(i+1) ns written in seconds, as Prometheus histograms expect
+  auto latency_prometheus(std::ostringstream &output, const std::string &name, const std::string &help, const Geodesic::LatencySummary &latency) -> void {
+    output << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " histogram\n";
+    uint64_t cumulative{0};
+    for(std::size_t i = 0; i + 1 < latency.buckets.size(); ++i) {
+      cumulative += latency.buckets[i];
+      output << name << "_bucket{le=\"" << static_cast<double>(uint64_t{2} << i) * 1e-9 << "\"} " << cumulative << "\n";
+    }
+    output << name << "_bucket{le=\"+Inf\"} " << latency.samples << "\n"
+           << name << "_sum " << static_cast<double>(latency.total_ns) * 1e-9 << "\n"
+           << name << "_count " << latency.samples << "\n";
+  }
+
+  auto counter_prometheus(std::ostringstream &output, const std::string &name, const std::string &help, uint64_t value) -> void {
+    output << "# HELP " << name << " " << help << "\n"
+           << "# TYPE " << name << " counter\n"
+           << name << " " << value << "\n";
+  }
+
+#ifdef GEODESIC_INSTRUMENTATION
+
+  auto merge(Geodesic::LatencySummary &into, const Geodesic::LatencySummary &from) -> void {
+    into.samples  += from.samples;
+    into.total_ns += from.total_ns;
+    into.max_ns    = std::max(into.max_ns, from.max_ns);
+    for(std::size_t i = 0; i < Geodesic::LATENCY_BUCKETS; ++i) {
+      into.buckets[i] += from.buckets[i];
+    }
+  }
+
+  auto merge(Geodesic::InstrumentationSnapshot &into, const Geodesic::InstrumentationSnapshot &from) -> void {
+    into.calls            += from.calls;
+    into.total_iterations += from.total_iterations;
+    into.coincident_exits += from.coincident_exits;
+    into.equatorial_cases += from.equatorial_cases;
+    into.non_converged    += from.non_converged;
+    for(std::size_t i = 0; i < into.iteration_histogram.size(); ++i) {
+      into.iteration_histogram[i] += from.iteration_histogram[i];
+    }
+    merge(into.solve_latency, from.solve_latency);
+    merge(into.batch_pair_latency, from.batch_pair_latency);
+  }
+
+  auto latency_bucket(uint64_t nanoseconds) -> std::size_t {
+    std::size_t bucket{0};
+    while(nanoseconds > 1 && bucket + 1 < Geodesic::LATENCY_BUCKETS) {
+      nanoseconds >>= 1;
+      ++bucket;
+    }
+    return bucket;
+  }
+
+  //NOTE - Only the owning thread writes (relaxed load + store, no locked instruction), snapshots read from any thread
+  auto bump(std::atomic<uint64_t> &counter, uint64_t amount = 1) -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+  }
+
+  struct AtomicLatency {
+    std::atomic<uint64_t> samples{0}, total_ns{0}, max_ns{0};
+    std::array<std::atomic<uint64_t>, Geodesic::LATENCY_BUCKETS> buckets{};
+
+    auto record(uint64_t nanoseconds) -> void {
+      bump(samples);
+      bump(total_ns, nanoseconds);
+      if(nanoseconds > max_ns.load(std::memory_order_relaxed)) {
+        max_ns.store(nanoseconds, std::memory_order_relaxed);
+      }
+      bump(buckets[latency_bucket(nanoseconds)]);
+    }
+
+    auto read() const -> Geodesic::LatencySummary {
+      Geodesic::LatencySummary latency{};
+      latency.samples  = samples.load(std::memory_order_relaxed);
+      latency.total_ns = total_ns.load(std::memory_order_relaxed);
+      latency.max_ns   = max_ns.load(std::memory_order_relaxed);
+      for(std::size_t i = 0; i < buckets.size(); ++i) {
+        latency.buckets[i] = buckets[i].load(std::memory_order_relaxed);
+      }
+      return latency;
+    }
+
+    auto clear() -> void {
+      samples.store(0, std::memory_order_relaxed);
+      total_ns.store(0, std::memory_order_relaxed);
+      max_ns.store(0, std::memory_order_relaxed);
+      for(std::atomic<uint64_t> &bucket : buckets) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  struct ThreadCounters;
+
+  //NOTE - Live threads register here, exiting threads fold their counts into retired
+  struct Registry {
+    std::mutex mutex{};
+    std::vector<ThreadCounters*> live{};
+    Geodesic::InstrumentationSnapshot retired{};
+  };
+
+  auto registry() -> Registry& {
+    static Registry instance{};
+    return instance;
+  }
+
+  struct ThreadCounters {
+    std::atomic<uint64_t> calls{0}, total_iterations{0}, coincident_exits{0}, equatorial_cases{0}, non_converged{0};
+    std::array<std::atomic<uint64_t>, Geodesic::VINCENTY_ITERATION_LIMIT + 1> iteration_histogram{};
+    AtomicLatency solve_latency{}, batch_pair_latency{};
+    unsigned solve_countdown{1}; //NOTE - Owner thread only
+
+    ThreadCounters() {
+      Registry &shared{registry()};
+      const std::lock_guard<std::mutex> lock{shared.mutex};
+      shared.live.push_back(this);
+    }
+
+    ThreadCounters(const ThreadCounters &other) = delete;
+    ThreadCounters &operator=(const ThreadCounters &other) = delete;
+
+    auto read() const -> Geodesic::InstrumentationSnapshot {
+      Geodesic::InstrumentationSnapshot snapshot{};
+      snapshot.calls            = calls.load(std::memory_order_relaxed);
+      snapshot.total_iterations = total_iterations.load(std::memory_order_relaxed);
+      snapshot.coincident_exits = coincident_exits.load(std::memory_order_relaxed);
+      snapshot.equatorial_cases = equatorial_cases.load(std::memory_order_relaxed);
+      snapshot.non_converged    = non_converged.load(std::memory_order_relaxed);
+      for(std::size_t i = 0; i < iteration_histogram.size(); ++i) {
+        snapshot.iteration_histogram[i] = iteration_histogram[i].load(std::memory_order_relaxed);
+      }
+      snapshot.solve_latency      = solve_latency.read();
+      snapshot.batch_pair_latency = batch_pair_latency.read();
+      return snapshot;
+    }
+
+    auto clear() -> void {
+      for(std::atomic<uint64_t> *counter : {&calls, &total_iterations, &coincident_exits, &equatorial_cases, &non_converged}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+      for(std::atomic<uint64_t> &bucket : iteration_histogram) {
+        bucket.store(0, std::memory_order_relaxed);
+      }
+      solve_latency.clear();
+      batch_pair_latency.clear();
+    }
+
+    ~ThreadCounters() {
+      Registry &shared{registry()};
+      const std::lock_guard<std::mutex> lock{shared.mutex};
+      merge(shared.retired, read());
+      shared.live.erase(std::remove(shared.live.begin(), shared.live.end(), this), shared.live.end());
+    }
+  };
+
+  auto thread_counters() -> ThreadCounters& {
+    thread_local ThreadCounters counters{};
+    return counters;
+  }
+
+#endif
+
+};
+
+#ifdef GEODESIC_INSTRUMENTATION
+
+auto Geodesic::Instrumentation::record_pair(unsigned iterations, PairOutcome outcome, bool equatorial) -> void {
+  ThreadCounters &counters{thread_counters()};
+  bump(counters.calls);
+  bump(counters.total_iterations, iterations);
+  bump(counters.iteration_histogram[std::min(iterations, VINCENTY_ITERATION_LIMIT)]);
+  if(outcome == PairOutcome::Coincident) {
+    bump(counters.coincident_exits);
+  }
+  else if(outcome == PairOutcome::NonConverged) {
+    bump(counters.non_converged);
+  }
+  if(equatorial) {
+    bump(counters.equatorial_cases);
+  }
+}
+
+auto Geodesic::Instrumentation::sample_solve() -> bool {
+  ThreadCounters &counters{thread_counters()};
+  if(--counters.solve_countdown > 0) {
+    return false;
+  }
+  counters.solve_countdown = LATENCY_SAMPLE_PERIOD;
+  return true;
+}
+
+auto Geodesic::Instrumentation::record_solve_latency(uint64_t nanoseconds) -> void {
+  thread_counters().solve_latency.record(nanoseconds);
+}
+
+auto Geodesic::Instrumentation::record_batch_latency(uint64_t nanoseconds, std::size_t pairs) -> void {
+  if(pairs > 0) {
+    thread_counters().batch_pair_latency.record(nanoseconds / pairs);
+  }
+}
+
+auto Geodesic::instrumentation_snapshot() -> InstrumentationSnapshot {
+  Registry &shared{registry()};
+  const std::lock_guard<std::mutex> lock{shared.mutex};
+  InstrumentationSnapshot snapshot{shared.retired};
+  for(const ThreadCounters *counters : shared.live) {
+    merge(snapshot, counters->read());
+  }
+  return snapshot;
+}
+
+auto Geodesic::reset_instrumentation() -> void {
+  Registry &shared{registry()};
+  const std::lock_guard<std::mutex> lock{shared.mutex};
+  shared.retired = InstrumentationSnapshot{};
+  for(ThreadCounters *counters : shared.live) {
+    counters->clear();
+  }
+}
+
+#else
+
+auto Geodesic::instrumentation_snapshot() -> InstrumentationSnapshot {
+  return InstrumentationSnapshot{};
+}
+
+auto Geodesic::reset_instrumentation() -> void {
+  //NOTE - Nothing is counted without GEODESIC_INSTRUMENTATION
+}
+
+#endif
+
+auto Geodesic::InstrumentationSnapshot::to_json() const -> std::string {
+  std::ostringstream output{};
+  output << "{\"enabled\":" << (enabled ? "true" : "false")
+         << ",\"calls\":" << calls
+         << ",\"total_iterations\":" << total_iterations
+         << ",\"coincident_exits\":" << coincident_exits
+         << ",\"equatorial_cases\":" << equatorial_cases
+         << ",\"non_converged\":" << non_converged
+         << ",\"iteration_histogram\":[";
+  for(std::size_t i = 0; i < iteration_histogram.size(); ++i) {
+    output << (i ? "," : "") << iteration_histogram[i];
+  }
+  output << "],\"solve_latency\":";
+  latency_json(output, solve_latency);
+  output << ",\"batch_pair_latency\":";
+  latency_json(output, batch_pair_latency);
+  output << "}\n";
+  return output.str();
+}
+
+auto Geodesic::InstrumentationSnapshot::to_prometheus() const -> std::string {
+  std::ostringstream output{};
+
+  output << "# HELP geodesic_vincenty_instrumentation_enabled 1 when the solvers were built with GEODESIC_INSTRUMENTATION\n"
+         << "# TYPE geodesic_vincenty_instrumentation_enabled gauge\n"
+         << "geodesic_vincenty_instrumentation_enabled " << (enabled ? 1 : 0) << "\n";
+  counter_prometheus(output, "geodesic_vincenty_calls_total", "Pairs solved by the Vincenty solvers", calls);
+  counter_prometheus(output, "geodesic_vincenty_coincident_exits_total", "Pairs that exited early as coincident points", coincident_exits);
+  counter_prometheus(output, "geodesic_vincenty_equatorial_cases_total", "Pairs that finished with cos_sq_alpha == 0", equatorial_cases);
+  counter_prometheus(output, "geodesic_vincenty_non_converged_total", "Pairs that hit the iteration limit and returned NaN", non_converged);
+
+  //NOTE - Fixed bucket bounds keep the series count small, the full histogram is in the JSON dump
+  constexpr unsigned ITERATION_BOUNDS[]{1, 2, 3, 4, 5, 6, 7, 8, 10, 15, 20, 30, 50, 75, VINCENTY_ITERATION_LIMIT - 1};
+  output << "# HELP geodesic_vincenty_iterations Lambda iterations per pair\n"
+         << "# TYPE geodesic_vincenty_iterations histogram\n";
+  uint64_t cumulative{0};
+  unsigned next{0};
+  for(const unsigned bound : ITERATION_BOUNDS) {
+    for(; next <= bound; ++next) {
+      cumulative += iteration_histogram[next];
+    }
+    output << "geodesic_vincenty_iterations_bucket{le=\"" << bound << "\"} " << cumulative << "\n";
+  }
+  output << "geodesic_vincenty_iterations_bucket{le=\"+Inf\"} " << calls << "\n"
+         << "geodesic_vincenty_iterations_sum " << total_iterations << "\n"
+         << "geodesic_vincenty_iterations_count " << calls << "\n";
+
+  latency_prometheus(output, "geodesic_vincenty_solve_seconds", "Sampled latency of scalar solves", solve_latency);
+  latency_prometheus(output, "geodesic_vincenty_batch_pair_seconds", "Batch call latency per pair", batch_pair_latency);
+  return output.str();
+}
@@ -0,0 +1,618 @@
+//NOTE - The inverse solution below is a port of GeographicLib's Geodesic::GenInverse and its helpers (Lambda12,
+//NOTE - InverseStart, Lengths, Astroid and the series coefficients), https://geographiclib.sourceforge.io, used under
+//NOTE - its license:
+//
+// The MIT License (MIT).
+//
+// Copyright (c) Charles Karney
+//
+// Permission is hereby granted, free of charge, to any person
+// obtaining a copy of this software and associated documentation
+// files (the "Software"), to deal in the Software without
+// restriction, including without limitation the rights to use, copy,
+// modify, merge, publish, distribute, sublicense, and/or sell copies
+// of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be
+// included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+// NONINFRINGEMENT.  IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+// HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+// WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+
+#include "GeodesicKarney.hpp"
+#include "GeoPoint.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace {
+
+  constexpr int    SERIES_ORDER{6};                     //NOTE - nA1 = nC1 = nA2 = nC2 = nA3 = nC3 = 6
+  constexpr int    COEFFICIENTS{SERIES_ORDER + 1};
+  constexpr double PI_D{static_cast<double>(WGS84::PI)};
+  constexpr double DEGREE{PI_D / 180};
+  constexpr double QUARTER_TURN{90}, HALF_TURN{180};
+
+  //NOTE - Newton iterations before falling back to pure bisection, and the hard cap on the whole loop
+  constexpr unsigned NEWTON_ITERATION_LIMIT{20};
+  constexpr unsigned ITERATION_LIMIT{NEWTON_ITERATION_LIMIT + std::numeric_limits<double>::digits + 10};
+
+  const double tiny{std::sqrt(std::numeric_limits<double>::min())};
+  constexpr double tol0{std::numeric_limits<double>::epsilon()};
+  constexpr double tol1{200 * tol0};
+  const double tol2{std::sqrt(tol0)};
+  const double tolb{tol0 * tol2};
+  const double xthresh{1000 * tol2};
+
+  auto sq(double x) -> double {
+    return x * x;
+  }
+
+  auto norm2(double &sinx, double &cosx) -> void {
+    const double r{std::hypot(sinx, cosx)};
+    sinx /= r;
+    cosx /= r;
+  }
+
+  //NOTE - Error-free sum, t receives the rounding error of s = u + v
+  auto sumx(double u, double v, double &t) -> double {
+    volatile double s{u + v};
+    volatile double up{s - v};
+    volatile double vpp{s - up};
+    up  -= u;
+    vpp -= v;
+    t = -(up + vpp);
+    return s;
+  }
+
+  //NOTE - Exact difference y - x of two angles in degrees, reduced to [-180, 180], e receives the rounding error
+  auto angle_difference(double x, double y, double &e) -> double {
+    double t{};
+    double d{sumx(std::remainder(-x, 360.0), std::remainder(y, 360.0), t)};
+    d = sumx(std::remainder(d, 360.0), t, t);
+    if(d == 0 || std::abs(d) == HALF_TURN) {
+      d = std::copysign(d, t == 0 ? y - x : -t);
+    }
+    e = t;
+    return d;
+  }
+
+  //NOTE - Snap tiny angles to multiples of 1/16 degree so that near-zero values do not cause trouble
+  auto angle_round(double x) -> double {
+    constexpr double z{1.0 / 16};
+    volatile double y{std::abs(x)};
+    volatile double w{z - y};
+    y = w > 0 ? z - w : y;
+    return std::copysign(y, x);
+  }
+
+  //NOTE - sin and cos of an angle in degrees, exact at multiples of 90 degrees
+  auto sincosd(double x, double &sinx, double &cosx) -> void {
+    int quadrant{0};
+    const double r{std::remquo(x, QUARTER_TURN, &quadrant) * DEGREE};
+    const double s{std::sin(r)}, c{std::cos(r)};
+    switch(static_cast<unsigned>(quadrant) & 3U) {
+      case 0U: sinx =  s; cosx =  c; break;
+      case 1U: sinx =  c; cosx = -s; break;
+      case 2U: sinx = -s; cosx = -c; break;
+      default: sinx = -c; cosx =  s; break;
+    }
+    cosx += 0.0;
+    if(sinx == 0) {
+      sinx = std::copysign(sinx, x);
+    }
+  }
+
+  auto polyval(int order, const double *p, double x) -> double {
+    double y{order < 0 ? 0 : *p++};
+    while(--order >= 0) {
+      y = y * x + *p++;
+    }
+    return y;
+  }
+
+  //NOTE - Clenshaw summation of sum(c[l] * sin(2 l x)) (sinp) or sum(c[l] * cos((2 l - 1) x))
+  auto sin_cos_series(bool sinp, double sinx, double cosx, const double *c, int n) -> double {
+    c += (n + sinp);
+    const double ar{2 * (cosx - sinx) * (cosx + sinx)};
+    double y0{(n & 1) ? *--c : 0}, y1{0};
+    n /= 2;
+    while(n--) {
+      y1 = ar * y0 - y1 + *--c;
+      y0 = ar * y1 - y0 + *--c;
+    }
+    return sinp ? 2 * sinx * cosx * y0 : cosx * (y0 - y1);
+  }
+
+  //SECTION - Series coefficients (Karney 2013, eqs. 17, 18, 42, 43, 24, 25)
+  auto A1m1f(double eps) -> double {
+    static constexpr double coeff[]{1, 4, 64, 0, 256};
+    const int m{SERIES_ORDER / 2};
+    const double t{polyval(m, coeff, sq(eps)) / coeff[m + 1]};
+    return (t + eps) / (1 - eps);
+  }
+
+  auto C1f(double eps, double c[]) -> void {
+    static constexpr double coeff[]{
+      -1, 6, -16, 32,
+      -9, 64, -128, 2048,
+      9, -16, 768,
+      3, -5, 512,
+      -7, 1280,
+      -7, 2048,
+    };
+    const double eps2{sq(eps)};
+    double d{eps};
+    int o{0};
+    for(int l = 1; l <= SERIES_ORDER; ++l) {
+      const int m{(SERIES_ORDER - l) / 2};
+      c[l] = d * polyval(m, coeff + o, eps2) / coeff[o + m + 1];
+      o += m + 2;
+      d *= eps;
+    }
+  }
+
+  auto A2m1f(double eps) -> double {
+    static constexpr double coeff[]{-11, -28, -192, 0, 256};
+    const int m{SERIES_ORDER / 2};
+    const double t{polyval(m, coeff, sq(eps)) / coeff[m + 1]};
+    return (t - eps) / (1 + eps);
+  }
+
+  auto C2f(double eps, double c[]) -> void {
+    static constexpr double coeff[]{
+      1, 2, 16, 32,
+      35, 64, 384, 2048,
+      15, 80, 768,
+      7, 35, 512,
+      63, 1280,
+      77, 2048,
+    };
+    const double eps2{sq(eps)};
+    double d{eps};
+    int o{0};
+    for(int l = 1; l <= SERIES_ORDER; ++l) {
+      const int m{(SERIES_ORDER - l) / 2};
+      c[l] = d * polyval(m, coeff + o, eps2) / coeff[o + m + 1];
+      o += m + 2;
+      d *= eps;
+    }
+  }
+
+  //REVIEW - WGS-84 constants and the n-dependent A3/C3 coefficients, computed once
+  struct Ellipsoid {
+    double a, f, f1, e2, ep2, n, b, etol2;
+    double A3x[SERIES_ORDER];
+    double C3x[(SERIES_ORDER * (SERIES_ORDER - 1)) / 2];
+
+    Ellipsoid() {
+      a     = static_cast<double>(WGS84::EARTH_RADIUS_WGS84);
+      f     = static_cast<double>(WGS84::FLATTENING_WGS84_ELLIPSOID);
+      f1    = 1 - f;
+      e2    = f * (2 - f);
+      ep2   = e2 / sq(f1);
+      n     = f / (2 - f);
+      b     = a * f1;
+      etol2 = 0.1 * tol2 / std::sqrt(std::max(0.001, std::abs(f)) * std::min(1.0, 1 - f / 2) / 2);
+
+      static constexpr double A3_coeff[]{
+        -3, 128,
+        -2, -3, 64,
+        -1, -3, -1, 16,
+        3, -1, -2, 8,
+        1, -1, 2,
+        1, 1,
+      };
+      int o{0}, k{0};
+      for(int j = SERIES_ORDER - 1; j >= 0; --j) {
+        const int m{std::min(SERIES_ORDER - j - 1, j)};
+        A3x[k++] = polyval(m, A3_coeff + o, n) / A3_coeff[o + m + 1];
+        o += m + 2;
+      }
+
+      static constexpr double C3_coeff[]{
+        3, 128,
+        2, 5, 128,
+        -1, 3, 3, 64,
+        -1, 0, 1, 8,
+        -1, 1, 4,
+        5, 256,
+        1, 3, 128,
+        -3, -2, 3, 64,
+        1, -3, 2, 32,
+        7, 512,
+        -10, 9, 384,
+        5, -9, 5, 192,
+        7, 512,
+        -14, 7, 512,
+        21, 2560,
+      };
+      o = 0;
+      k = 0;
+      for(int l = 1; l < SERIES_ORDER; ++l) {
+        for(int j = SERIES_ORDER - 1; j >= l; --j) {
+          const int m{std::min(SERIES_ORDER - j - 1, j)};
+          C3x[k++] = polyval(m, C3_coeff + o, n) / C3_coeff[o + m + 1];
+          o += m + 2;
+        }
+      }
+    }
+
+    auto A3f(double eps) const -> double {
+      return polyval(SERIES_ORDER - 1, A3x, eps);
+    }
+
+    auto C3f(double eps, double c[]) const -> void {
+      double mult{1};
+      int o{0};
+      for(int l = 1; l < SERIES_ORDER; ++l) {
+        const int m{SERIES_ORDER - l - 1};
+        mult *= eps;
+        c[l] = mult * polyval(m, C3x + o, eps);
+        o += m + 1;
+      }
+    }
+  };
+
+  const Ellipsoid wgs84{};
+
+  //NOTE - Distance (s12b) and reduced length (m12b) along the auxiliary sphere, both scaled by b
+  auto lengths(double eps, double sig12, double ssig1, double csig1, double dn1, double ssig2, double csig2, double dn2, double *s12b, double *m12b) -> void {
+    double Ca[COEFFICIENTS], Cb[COEFFICIENTS];
+    const double A1{1 + A1m1f(eps)};
+    C1f(eps, Ca);
+
+    double J12{0};
+    if(m12b != nullptr) {
+      const double A2{1 + A2m1f(eps)};
+      C2f(eps, Cb);
+      const double m0{A1 - A2};
+      const double B1{sin_cos_series(true, ssig2, csig2, Ca, SERIES_ORDER) - sin_cos_series(true, ssig1, csig1, Ca, SERIES_ORDER)};
+      const double B2{sin_cos_series(true, ssig2, csig2, Cb, SERIES_ORDER) - sin_cos_series(true, ssig1, csig1, Cb, SERIES_ORDER)};
+      J12 = m0 * sig12 + (A1 * B1 - A2 * B2);
+      if(s12b != nullptr) {
+        *s12b = A1 * (sig12 + B1);
+      }
+      *m12b = dn2 * (csig1 * ssig2) - dn1 * (ssig1 * csig2) - csig1 * csig2 * J12;
+    }
+    else if(s12b != nullptr) {
+      const double B1{sin_cos_series(true, ssig2, csig2, Ca, SERIES_ORDER) - sin_cos_series(true, ssig1, csig1, Ca, SERIES_ORDER)};
+      *s12b = A1 * (sig12 + B1);
+    }
+  }
+
+  //NOTE - Largest root of k^4 + 2 k^3 - (x^2 + y^2 - 1) k^2 - 2 y^2 k - y^2 = 0, seeds nearly antipodal pairs
+  auto astroid(double x, double y) -> double {
+    const double p{sq(x)}, q{sq(y)}, r{(p + q - 1) / 6};
+    if(q == 0 && r <= 0) {
+      return 0;
+    }
+
+    const double S{p * q / 4}, r2{sq(r)}, r3{r * r2};
+    const double disc{S * (S + 2 * r3)};
+    double u{r};
+    if(disc >= 0) {
+      double T3{S + r3};
+      T3 += T3 < 0 ? -std::sqrt(disc) : std::sqrt(disc);
+      const double T{std::cbrt(T3)};
+      u += T + (T != 0 ? r2 / T : 0);
+    }
+    else {
+      const double angle{std::atan2(std::sqrt(-disc), -(S + r3))};
+      u += 2 * r * std::cos(angle / 3);
+    }
+    const double v{std::sqrt(sq(u) + q)};
+    const double uv{u < 0 ? q / (v - u) : u + v};
+    const double w{(uv - q) / (2 * v)};
+    return uv / (std::sqrt(uv + sq(w)) + w);
+  }
+
+  //NOTE - Starting azimuth, returns sig12 >= 0 when the short-line closed form already solves the problem
+  auto inverse_start(double sbet1, double cbet1, double sbet2, double cbet2, double lam12, double slam12, double clam12,
+                     double &salp1, double &calp1, double &salp2, double &calp2, double &dnm) -> double {
+    double sig12{-1};
+    const double sbet12{sbet2 * cbet1 - cbet2 * sbet1};
+    const double cbet12{cbet2 * cbet1 + sbet2 * sbet1};
+    const double sbet12a{sbet2 * cbet1 + cbet2 * sbet1};
+    const bool shortline{cbet12 >= 0 && sbet12 < 0.5 && cbet2 * lam12 < 0.5};
+    double somg12{}, comg12{};
+
+    dnm = 0;
+    if(shortline) {
+      double sbetm2{sq(sbet1 + sbet2)};
+      sbetm2 /= sbetm2 + sq(cbet1 + cbet2);
+      dnm = std::sqrt(1 + wgs84.ep2 * sbetm2);
+      const double omg12{lam12 / (wgs84.f1 * dnm)};
+      somg12 = std::sin(omg12);
+      comg12 = std::cos(omg12);
+    }
+    else {
+      somg12 = slam12;
+      comg12 = clam12;
+    }
+
+    salp1 = cbet2 * somg12;
+    calp1 = comg12 >= 0 ? sbet12 + cbet2 * sbet1 * sq(somg12) / (1 + comg12) : sbet12a - cbet2 * sbet1 * sq(somg12) / (1 - comg12);
+
+    const double ssig12{std::hypot(salp1, calp1)};
+    const double csig12{sbet1 * sbet2 + cbet1 * cbet2 * comg12};
+
+    if(shortline && ssig12 < wgs84.etol2) {
+      salp2 = cbet1 * somg12;
+      calp2 = sbet12 - cbet1 * sbet2 * (comg12 >= 0 ? sq(somg12) / (1 + comg12) : 1 - comg12);
+      norm2(salp2, calp2);
+      sig12 = std::atan2(ssig12, csig12);
+    }
+    else if(std::abs(wgs84.n) > 0.1 || csig12 >= 0 || ssig12 >= 6 * std::abs(wgs84.n) * PI_D * sq(cbet1)) {
+      //NOTE - Zeroth order spherical approximation is good enough
+    }
+    else {
+      //REVIEW - Nearly antipodal, scale onto the astroid
+      const double lam12x{std::atan2(-slam12, -clam12)};
+      const double k2{sq(sbet1) * wgs84.ep2};
+      const double eps{k2 / (2 * (1 + std::sqrt(1 + k2)) + k2)};
+      const double lamscale{wgs84.f * cbet1 * wgs84.A3f(eps) * PI_D};
+      const double betscale{lamscale * cbet1};
+      const double x{lam12x / lamscale};
+      const double y{sbet12a / betscale};
+
+      if(y > -tol1 && x > -1 - xthresh) {
+        salp1 = std::min(1.0, -x);
+        calp1 = -std::sqrt(1 - sq(salp1));
+      }
+      else {
+        const double k{astroid(x, y)};
+        const double omg12a{lamscale * (-x * k / (1 + k))};
+        somg12 = std::sin(omg12a);
+        comg12 = -std::cos(omg12a);
+        salp1  = cbet2 * somg12;
+        calp1  = sbet12a - cbet2 * sbet1 * sq(somg12) / (1 - comg12);
+      }
+    }
+
+    if(!(salp1 <= 0)) {
+      norm2(salp1, calp1);
+    }
+    else {
+      salp1 = 1;
+      calp1 = 0;
+    }
+    return sig12;
+  }
+
+  struct Lambda12State {
+    double salp2, calp2, sig12, ssig1, csig1, ssig2, csig2, eps;
+  };
+
+  //NOTE - Longitude difference reached by the geodesic leaving point 1 with azimuth alp1, minus the target, and its
+  //NOTE - derivative with respect to alp1 (through the reduced length) when diffp is set
+  auto lambda12(double sbet1, double cbet1, double dn1, double sbet2, double cbet2, double dn2, double salp1, double calp1,
+                double slam120, double clam120, bool diffp, double &dlam12, Lambda12State &state) -> double {
+    if(sbet1 == 0 && calp1 == 0) {
+      calp1 = -tiny;
+    }
+
+    const double salp0{salp1 * cbet1};
+    const double calp0{std::hypot(calp1, salp1 * sbet1)};
+
+    double ssig1{sbet1}, csig1{calp1 * cbet1};
+    const double somg1{salp0 * sbet1}, comg1{calp1 * cbet1};
+    norm2(ssig1, csig1);
+
+    const double salp2{cbet2 != cbet1 ? salp0 / cbet2 : salp1};
+    const double calp2{
+      cbet2 != cbet1 || std::abs(sbet2) != -sbet1
+        ? std::sqrt(sq(calp1 * cbet1) + (cbet1 < -sbet1 ? (cbet2 - cbet1) * (cbet1 + cbet2) : (sbet1 - sbet2) * (sbet1 + sbet2))) / cbet2
+        : std::abs(calp1)
+    };
+
+    double ssig2{sbet2}, csig2{calp2 * cbet2};
+    const double somg2{salp0 * sbet2}, comg2{calp2 * cbet2};
+    norm2(ssig2, csig2);
+
+    const double sig12{std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0, csig1 * csig2 + ssig1 * ssig2)};
+    const double somg12{std::max(0.0, comg1 * somg2 - somg1 * comg2) + 0.0};
+    const double comg12{comg1 * comg2 + somg1 * somg2};
+    const double eta{std::atan2(somg12 * clam120 - comg12 * slam120, comg12 * clam120 + somg12 * slam120)};
+
+    const double k2{sq(calp0) * wgs84.ep2};
+    const double eps{k2 / (2 * (1 + std::sqrt(1 + k2)) + k2)};
+    double Ca[COEFFICIENTS];
+    wgs84.C3f(eps, Ca);
+    const double B312{sin_cos_series(true, ssig2, csig2, Ca, SERIES_ORDER - 1) - sin_cos_series(true, ssig1, csig1, Ca, SERIES_ORDER - 1)};
+    const double domg12{-wgs84.f * wgs84.A3f(eps) * salp0 * (sig12 + B312)};
+
+    if(diffp) {
+      if(calp2 == 0) {
+        dlam12 = -2 * wgs84.f1 * dn1 / sbet1;
+      }
+      else {
+        lengths(eps, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, nullptr, &dlam12);
+        dlam12 *= wgs84.f1 / (calp2 * cbet2);
+      }
+    }
+
+    state = Lambda12State{salp2, calp2, sig12, ssig1, csig1, ssig2, csig2, eps};
+    return eta + domg12;
+  }
+
+  //NOTE - Tolerance on the longitude residual, 0.5 mm / 0.5 um of arc on the equator. The distance error comes out at
+  //NOTE - up to about 1.01 times the residual arc on near-antipodal pairs, so a full 1 mm / 1 um would overshoot.
+  auto residual_tolerance(Geodesic::KarneyAccuracy accuracy) -> double {
+    switch(accuracy) {
+      case Geodesic::KarneyAccuracy::Millimetre: return std::max(tol0, 0.5e-3 / wgs84.a);
+      case Geodesic::KarneyAccuracy::Micrometre: return std::max(tol0, 0.5e-6 / wgs84.a);
+      default:                                   return tol0;
+    }
+  }
+
+};
+
+auto Geodesic::karney_inverse_WGS84(double latitude_1, double longitude_1, double latitude_2, double longitude_2, KarneyAccuracy accuracy, unsigned *iterations) -> double {
+
+  const double tolerance{residual_tolerance(accuracy)};
+  unsigned numit{0};
+
+  //REVIEW - Reduce to the canonical configuration: lon12 in [0, 180], |lat1| >= |lat2|, lat1 <= 0
+  double lon12s{};
+  double lon12{angle_difference(longitude_1, longitude_2, lon12s)};
+  const double lonsign{std::signbit(lon12) ? -1.0 : 1.0};
+  lon12  = lonsign * angle_round(lon12);
+  lon12s = angle_round((HALF_TURN - lon12) - lonsign * lon12s);
+  const double lam12{lon12 * DEGREE};
+  double slam12{}, clam12{};
+  if(lon12 > QUARTER_TURN) {
+    sincosd(lon12s, slam12, clam12);
+    clam12 = -clam12;
+  }
+  else {
+    sincosd(lon12, slam12, clam12);
+  }
+
+  double lat1{std::abs(latitude_1) > QUARTER_TURN ? std::numeric_limits<double>::quiet_NaN() : angle_round(latitude_1)};
+  double lat2{std::abs(latitude_2) > QUARTER_TURN ? std::numeric_limits<double>::quiet_NaN() : angle_round(latitude_2)};
+  if(std::abs(lat1) < std::abs(lat2) || std::isnan(lat2)) {
+    std::swap(lat1, lat2);
+  }
+  const double latsign{std::signbit(lat1) ? 1.0 : -1.0};
+  lat1 *= latsign;
+  lat2 *= latsign;
+
+  double sbet1{}, cbet1{}, sbet2{}, cbet2{};
+  sincosd(lat1, sbet1, cbet1);
+  sbet1 *= wgs84.f1;
+  norm2(sbet1, cbet1);
+  cbet1 = std::max(tiny, cbet1);
+
+  sincosd(lat2, sbet2, cbet2);
+  sbet2 *= wgs84.f1;
+  norm2(sbet2, cbet2);
+  cbet2 = std::max(tiny, cbet2);
+
+  //NOTE - Make the symmetric cases (|bet1| == |bet2|) exact so lambda12 sees them as such
+  if(cbet1 < -sbet1) {
+    if(cbet2 == cbet1) {
+      sbet2 = std::copysign(sbet1, sbet2);
+    }
+  }
+  else if(std::abs(sbet2) == -sbet1) {
+    cbet2 = cbet1;
+  }
+
+  const double dn1{std::sqrt(1 + wgs84.ep2 * sq(sbet1))};
+  const double dn2{std::sqrt(1 + wgs84.ep2 * sq(sbet2))};
+
+  double s12x{0}, m12x{0}, sig12{0}, salp1{0}, calp1{0}, salp2{0}, calp2{0};
+  bool meridian{lat1 == -QUARTER_TURN || slam12 == 0};
+
+  //REVIEW - Meridional geodesic, closed form
+  if(meridian) {
+    calp1 = clam12;
+    salp1 = slam12;
+    calp2 = 1;
+    salp2 = 0;
+
+    const double ssig1{sbet1}, csig1{calp1 * cbet1};
+    const double ssig2{sbet2}, csig2{calp2 * cbet2};
+    sig12 = std::atan2(std::max(0.0, csig1 * ssig2 - ssig1 * csig2) + 0.0, csig1 * csig2 + ssig1 * ssig2);
+    lengths(wgs84.n, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2, &s12x, &m12x);
+
+    if(sig12 < 1 || m12x >= 0) {
+      if(sig12 < 3 * tiny || (sig12 < tol0 && (s12x < 0 || m12x < 0))) {
+        sig12 = m12x = s12x = 0;
+      }
+      s12x *= wgs84.b;
+    }
+    else {
+      meridian = false;
+    }
+  }
+
+  //REVIEW - Equatorial geodesic, closed form
+  if(!meridian && sbet1 == 0 && lon12s >= wgs84.f * HALF_TURN) {
+    s12x = wgs84.a * lam12;
+  }
+  else if(!meridian) {
+    double dnm{0};
+    sig12 = inverse_start(sbet1, cbet1, sbet2, cbet2, lam12, slam12, clam12, salp1, calp1, salp2, calp2, dnm);
+
+    if(sig12 >= 0) {
+      //NOTE - Short line solved by the starting estimate
+      s12x = sig12 * wgs84.b * dnm;
+    }
+    else {
+      //REVIEW - Newton on alp1, with a bracketing interval to bisect whenever a step misbehaves
+      Lambda12State state{};
+      double salp1a{tiny}, calp1a{1}, salp1b{tiny}, calp1b{-1};
+      bool tripn{false}, tripb{false};
+
+      for(;; ++numit) {
+        double dv{0};
+        const double v{lambda12(sbet1, cbet1, dn1, sbet2, cbet2, dn2, salp1, calp1, slam12, clam12, numit < NEWTON_ITERATION_LIMIT, dv, state)};
+
+        if(tripb || !(std::abs(v) >= (tripn ? 8 : 1) * tolerance) || numit == ITERATION_LIMIT) {
+          break;
+        }
+
+        if(v > 0 && (numit > NEWTON_ITERATION_LIMIT || calp1 / salp1 > calp1b / salp1b)) {
+          salp1b = salp1;
+          calp1b = calp1;
+        }
+        else if(v < 0 && (numit > NEWTON_ITERATION_LIMIT || calp1 / salp1 < calp1a / salp1a)) {
+          salp1a = salp1;
+          calp1a = calp1;
+        }
+
+        if(numit < NEWTON_ITERATION_LIMIT && dv > 0) {
+          const double dalp1{-v / dv};
+          if(std::abs(dalp1) < PI_D) {
+            const double sdalp1{std::sin(dalp1)}, cdalp1{std::cos(dalp1)};
+            const double nsalp1{salp1 * cdalp1 + calp1 * sdalp1};
+            if(nsalp1 > 0) {
+              calp1 = calp1 * cdalp1 - salp1 * sdalp1;
+              salp1 = nsalp1;
+              norm2(salp1, calp1);
+              tripn = std::abs(v) <= 16 * tolerance;
+              continue;
+            }
+          }
+        }
+
+        salp1 = (salp1a + salp1b) / 2;
+        calp1 = (calp1a + calp1b) / 2;
+        norm2(salp1, calp1);
+        tripn = false;
+        tripb = (std::abs(salp1a - salp1) + (calp1a - calp1) < tolb || std::abs(salp1 - salp1b) + (calp1 - calp1b) < tolb);
+      }
+
+      sig12 = state.sig12;
+      lengths(state.eps, sig12, state.ssig1, state.csig1, dn1, state.ssig2, state.csig2, dn2, &s12x, nullptr);
+      s12x *= wgs84.b;
+    }
+  }
+
+  if(iterations != nullptr) {
+    *iterations = numit;
+  }
+  return 0 + s12x; //NOTE - Turns -0 into 0
+}
+
+auto Geodesic::karney_inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, KarneyAccuracy accuracy, unsigned *iterations) -> double {
+  return karney_inverse_WGS84(point_1.latitude, point_1.longitude, point_2.latitude, point_2.longitude, accuracy, iterations);
+}
+
+auto Geodesic::inverse_WGS84(const GeoPoint &point_1, const GeoPoint &point_2, InverseSolver solver, KarneyAccuracy accuracy) -> long double {
+  if(solver == InverseSolver::Karney) {
+    return karney_inverse_WGS84(point_1, point_2, accuracy);
+  }
+  return vincenty_inverse_WGS84(point_1, point_2);
+}
@@ -0,0 +1,179 @@
+#include "GeodesicTiered.hpp"
+#include "Ellipsoid.hpp"
+#include "Geodesic.hpp"
+#include "GeodesicKarney.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+  //REVIEW - Per-thread tier counters
+  //NOTE - Same scheme as GeodesicInstrumentation: each thread counts into its own cache lines with a relaxed load +
+  //NOTE - store, tier_statistics() sums the live threads and what exited threads left in retired.
+  struct ThreadTierCounters;
+
+  struct TierRegistry {
+    std::mutex mutex{};
+    std::vector<ThreadTierCounters*> live{};
+    Geodesic::TierStatistics retired{};
+  };
+
+  auto tier_registry() -> TierRegistry& {
+    static TierRegistry instance{};
+    return instance;
+  }
+
+  auto merge(Geodesic::TierStatistics &into, const Geodesic::TierStatistics &from) -> void {
+    into.calls               += from.calls;
+    into.settled_by_estimate += from.settled_by_estimate;
+    into.exact_runs          += from.exact_runs;
+  }
+
+  //NOTE - Only the owning thread writes, no locked instruction
+  auto bump(std::atomic<uint64_t> &counter) -> void {
+    counter.store(counter.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+  }
+
+  struct alignas(64) ThreadTierCounters {
+    std::atomic<uint64_t> calls{0}, settled_by_estimate{0}, exact_runs{0};
+
+    ThreadTierCounters() {
+      TierRegistry &shared{tier_registry()};
+      const std::lock_guard<std::mutex> lock{shared.mutex};
+      shared.live.push_back(this);
+    }
+
+    ThreadTierCounters(const ThreadTierCounters &other) = delete;
+    ThreadTierCounters &operator=(const ThreadTierCounters &other) = delete;
+
+    auto read() const -> Geodesic::TierStatistics {
+      return Geodesic::TierStatistics{
+        calls.load(std::memory_order_relaxed), settled_by_estimate.load(std::memory_order_relaxed), exact_runs.load(std::memory_order_relaxed)
+      };
+    }
+
+    auto clear() -> void {
+      for(std::atomic<uint64_t> *counter : {&calls, &settled_by_estimate, &exact_runs}) {
+        counter->store(0, std::memory_order_relaxed);
+      }
+    }
+
+    ~ThreadTierCounters() {
+      TierRegistry &shared{tier_registry()};
+      const std::lock_guard<std::mutex> lock{shared.mutex};
+      merge(shared.retired, read());
+      shared.live.erase(std::remove(shared.live.begin(), shared.live.end(), this), shared.live.end());
+    }
+  };
+
+  auto tier_counters() -> ThreadTierCounters& {
+    thread_local ThreadTierCounters counters{};
+    return counters;
+  }
+
+};
+
+auto Geodesic::approximate_distance_WGS84(const GeoPoint &point_1, const GeoPoint &point_2) -> DistanceEstimate {
+
+  using K = EllipsoidConstants<WGS84Ellipsoid, double>;
+  constexpr double f{K::f};
+  constexpr double a{K::a};
+
+  //NOTE - Reduced latitudes as normalised ((1 - f) sin(phi), cos(phi)), same as the batch kernel
+  auto reduced = [](double phi, double &sinU, double &cosU) -> void {
+    const double y{(1 - f) * std::sin(phi)};
+    const double x{std::abs(std::cos(phi))};
+    const double h{std::hypot(x, y)};
+    sinU = y / h;
+    cosU = x / h;
+  };
+
+  double sinU1{}, cosU1{}, sinU2{}, cosU2{};
+  reduced(point_1.latitude_radians(), sinU1, cosU1);
+  reduced(point_2.latitude_radians(), sinU2, cosU2);
+
+  const double L{point_2.longitude_radians() - point_1.longitude_radians()};
+  const double sin_L{std::sin(L)}, cos_L{std::cos(L)};
+  const double x{cosU2 * sin_L};
+  const double y{cosU1 * sinU2 - sinU1 * cosU2 * cos_L};
+  const double sin_sigma{std::sqrt(x * x + y * y)};
+  const double cos_sigma{sinU1 * sinU2 + cosU1 * cosU2 * cos_L};
+  const double sigma{std::atan2(sin_sigma, cos_sigma)};
+
+  //REVIEW - Co-incident Points
+  if(sin_sigma == 0 && cos_sigma > 0) {
+    return DistanceEstimate{0.0, APPROXIMATE_ABSOLUTE_ERROR};
+  }
+
+  //NOTE - sin(P) cos(Q) and cos(P) sin(Q) with P, Q the half sum and half difference of the reduced latitudes
+  const double sinP_cosQ{(sinU1 + sinU2) / 2};
+  const double cosP_sinQ{(sinU2 - sinU1) / 2};
+  const double sin_half{std::sin(sigma / 2)}, cos_half{std::cos(sigma / 2)};
+
+  const double X{(sigma - sin_sigma) * sinP_cosQ * sinP_cosQ / (cos_half * cos_half)};
+  const double Y{(sigma + sin_sigma) * cosP_sinQ * cosP_sinQ / (sin_half * sin_half)};
+  const double distance{a * (sigma - f / 2 * (X + Y))};
+
+  const double error_bound{
+    (sigma <= APPROXIMATE_MAX_CENTRAL_ANGLE) ? APPROXIMATE_RELATIVE_ERROR * distance + APPROXIMATE_ABSOLUTE_ERROR : std::numeric_limits<double>::infinity()
+  };
+  return DistanceEstimate{distance, error_bound};
+
+}
+
+auto Geodesic::exact_distance_WGS84(const GeoPoint &point_1, const GeoPoint &point_2) -> double {
+  const double distance{static_cast<double>(vincenty_inverse_WGS84(point_1, point_2))};
+  if(std::isnan(distance)) {
+    return karney_inverse_WGS84(point_1, point_2);
+  }
+  return distance;
+}
+
+auto Geodesic::within_distance(const GeoPoint &point_1, const GeoPoint &point_2, double threshold, DistanceTier tier) -> bool {
+  ThreadTierCounters &counters{tier_counters()};
+  bump(counters.calls);
+
+  if(tier == DistanceTier::Auto) {
+    const DistanceEstimate estimate{approximate_distance_WGS84(point_1, point_2)};
+    if(estimate.distance + estimate.error_bound <= threshold) {
+      bump(counters.settled_by_estimate);
+      return true;
+    }
+    if(estimate.distance - estimate.error_bound > threshold) {
+      bump(counters.settled_by_estimate);
+      return false;
+    }
+  }
+
+  bump(counters.exact_runs);
+  return exact_distance_WGS84(point_1, point_2) <= threshold;
+}
+
+auto Geodesic::TierStatistics::settled_share() const -> double {
+  return (calls == 0) ? 0.0 : static_cast<double>(settled_by_estimate) / static_cast<double>(calls);
+}
+
+auto Geodesic::tier_statistics() -> TierStatistics {
+  TierRegistry &shared{tier_registry()};
+  const std::lock_guard<std::mutex> lock{shared.mutex};
+  TierStatistics statistics{shared.retired};
+  for(const ThreadTierCounters *counters : shared.live) {
+    merge(statistics, counters->read());
+  }
+  return statistics;
+}
+
+auto Geodesic::reset_tier_statistics() -> void {
+  TierRegistry &shared{tier_registry()};
+  const std::lock_guard<std::mutex> lock{shared.mutex};
+  shared.retired = TierStatistics{};
+  for(ThreadTierCounters *counters : shared.live) {
+    counters->clear();
+  }
+}
@@ -0,0 +1,45 @@
+#include "LocationNameTable.hpp"
+
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+LocationNameTable::LocationNameTable() {
+  m_names.emplace_back();
+  m_index.emplace(m_names.back(), 0);
+}
+
+auto LocationNameTable::instance() -> LocationNameTable& {
+  static LocationNameTable table{};
+  return table;
+}
+
+auto LocationNameTable::intern(std::string_view name) -> uint32_t {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  const auto found{m_index.find(name)};
+  if(found != m_index.end()) {
+    return found->second;
+  }
+
+  const uint32_t id{static_cast<uint32_t>(m_names.size())};
+  m_names.emplace_back(name);
+  m_index.emplace(m_names.back(), id);
+  return id;
+}
+
+auto LocationNameTable::name(uint32_t id) const -> const std::string& {
+  std::lock_guard<std::mutex> lock{m_mutex};
+
+  if(id >= m_names.size()) {
+    throw std::out_of_range("\nLocationNameTable(" + std::to_string(id) + ")\nUnknown location name id.\n");
+  }
+  return m_names[id];
+}
+
+auto LocationNameTable::size() const -> std::size_t {
+  std::lock_guard<std::mutex> lock{m_mutex};
+  return m_names.size();
+}
@@ -0,0 +1,123 @@
+#include "MappedFile.hpp"
+
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+  #ifndef NOMINMAX
+    #define NOMINMAX
+  #endif
+  #include <windows.h>
+#else
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+namespace {
+
+  [[noreturn]] auto throw_mapping_error(const std::string &path, const char *reason) -> void {
+    throw std::runtime_error("\nMappedFile(" + path + ")\n" + reason + "\n");
+  }
+
+};
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &path) {
+  m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+  if(m_file == INVALID_HANDLE_VALUE) {
+    m_file = nullptr;
+    throw_mapping_error(path, "File could not be opened.");
+  }
+
+  LARGE_INTEGER size{};
+  if(!GetFileSizeEx(m_file, &size)) {
+    release();
+    throw_mapping_error(path, "File size could not be read.");
+  }
+  m_size = static_cast<std::size_t>(size.QuadPart);
+  if(m_size == 0) {
+    return;
+  }
+
+  m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if(m_mapping == nullptr) {
+    release();
+    throw_mapping_error(path, "File could not be mapped.");
+  }
+  m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+  if(m_data == nullptr) {
+    release();
+    throw_mapping_error(path, "File could not be mapped.");
+  }
+}
+
+auto MappedFile::release() -> void {
+  if(m_data != nullptr) {
+    UnmapViewOfFile(m_data);
+  }
+  if(m_mapping != nullptr) {
+    CloseHandle(m_mapping);
+  }
+  if(m_file != nullptr) {
+    CloseHandle(m_file);
+  }
+  m_data    = nullptr;
+  m_mapping = nullptr;
+  m_file    = nullptr;
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &path) {
+  m_descriptor = ::open(path.c_str(), O_RDONLY);
+  if(m_descriptor < 0) {
+    throw_mapping_error(path, "File could not be opened.");
+  }
+
+  struct stat status{};
+  if(::fstat(m_descriptor, &status) != 0) {
+    release();
+    throw_mapping_error(path, "File size could not be read.");
+  }
+  m_size = static_cast<std::size_t>(status.st_size);
+  if(m_size == 0) {
+    return;
+  }
+
+  void *mapping{::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_descriptor, 0)};
+  if(mapping == MAP_FAILED) {
+    release();
+    throw_mapping_error(path, "File could not be mapped.");
+  }
+  ::madvise(mapping, m_size, MADV_SEQUENTIAL);
+  m_data = static_cast<const char*>(mapping);
+}
+
+auto MappedFile::release() -> void {
+  if(m_data != nullptr) {
+    ::munmap(const_cast<char*>(m_data), m_size);
+  }
+  if(m_descriptor >= 0) {
+    ::close(m_descriptor);
+  }
+  m_data       = nullptr;
+  m_descriptor = -1;
+}
+
+#endif
+
+auto MappedFile::data() const -> const char* {
+  return m_data;
+}
+
+auto MappedFile::size() const -> std::size_t {
+  return m_size;
+}
+
+MappedFile::~MappedFile() {
+  release();
+}
@@ -0,0 +1,383 @@
+#include "SpatialIndex.hpp"
+#include "Ellipsoid.hpp"
+#include "GeodesicTiered.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+
+  constexpr char INDEX_MAGIC[8]{'G', 'E', 'O', 'K', 'D', 'T', 'R', 'E'};
+  constexpr uint32_t INDEX_VERSION{1};
+
+  struct IndexFileHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t entry_size;
+    uint64_t count;
+  };
+
+  static_assert(std::is_trivially_copyable<Geodesic::IndexEntry>::value, "IndexEntry is written to disk byte for byte");
+  static_assert(sizeof(IndexFileHeader) % alignof(Geodesic::IndexEntry) == 0, "Mapped entries must stay aligned");
+
+  //NOTE - Slack on chord comparisons so round-off in the ECEF conversion never prunes a point right on the boundary
+  constexpr double CHORD_SLACK{1e-6};
+
+  auto make_entry(uint32_t id, const GeoPoint &point) -> Geodesic::IndexEntry {
+    Geodesic::IndexEntry entry{};
+    Geodesic::SpatialIndex::to_ecef(point, entry.ecef);
+    entry.point = point;
+    entry.id    = id;
+    return entry;
+  }
+
+  auto chord(const double (&a)[3], const double (&b)[3]) -> double {
+    const double dx{a[0] - b[0]}, dy{a[1] - b[1]}, dz{a[2] - b[2]};
+    return std::sqrt(dx * dx + dy * dy + dz * dz);
+  }
+
+  //NOTE - Median split on the axis of largest spread, the median lands in the middle slot of the range
+  auto build_tree(Geodesic::IndexEntry *entries, std::size_t begin, std::size_t end) -> void {
+    if(end - begin < 1) {
+      return;
+    }
+
+    double low[3]{entries[begin].ecef[0], entries[begin].ecef[1], entries[begin].ecef[2]};
+    double high[3]{low[0], low[1], low[2]};
+    for(std::size_t i = begin + 1; i < end; ++i) {
+      for(std::size_t axis = 0; axis < 3; ++axis) {
+        low[axis]  = std::min(low[axis], entries[i].ecef[axis]);
+        high[axis] = std::max(high[axis], entries[i].ecef[axis]);
+      }
+    }
+    uint8_t axis{0};
+    for(uint8_t candidate = 1; candidate < 3; ++candidate) {
+      if(high[candidate] - low[candidate] > high[axis] - low[axis]) {
+        axis = candidate;
+      }
+    }
+
+    const std::size_t middle{begin + (end - begin) / 2};
+    std::nth_element(entries + begin, entries + middle, entries + end, [axis](const Geodesic::IndexEntry &lhs, const Geodesic::IndexEntry &rhs) {
+      return lhs.ecef[axis] < rhs.ecef[axis];
+    });
+    entries[middle].axis = axis;
+
+    build_tree(entries, begin, middle);
+    build_tree(entries, middle + 1, end);
+  }
+
+  auto by_distance(const Geodesic::IndexHit &lhs, const Geodesic::IndexHit &rhs) -> bool {
+    return lhs.distance < rhs.distance;
+  }
+
+};
+
+auto Geodesic::SpatialIndex::to_ecef(const GeoPoint &point, double (&ecef)[3]) -> void {
+  using K = EllipsoidConstants<WGS84Ellipsoid, double>;
+  constexpr double a{K::a};
+  constexpr double f{K::f};
+  constexpr double e2{f * (2 - f)};
+
+  const double sin_phi{std::sin(point.latitude_radians())}, cos_phi{std::cos(point.latitude_radians())};
+  const double sin_lambda{std::sin(point.longitude_radians())}, cos_lambda{std::cos(point.longitude_radians())};
+  const double N{a / std::sqrt(1 - e2 * sin_phi * sin_phi)}; //NOTE - Prime vertical radius of curvature
+
+  ecef[0] = N * cos_phi * cos_lambda;
+  ecef[1] = N * cos_phi * sin_lambda;
+  ecef[2] = N * (1 - e2) * sin_phi;
+}
+
+Geodesic::SpatialIndex::SpatialIndex(const GeoPoint *points, std::size_t count):
+SpatialIndex{} {
+  m_owned.reserve(count);
+  for(std::size_t i = 0; i < count; ++i) {
+    points[i].validate();
+    m_owned.push_back(make_entry(static_cast<uint32_t>(i), points[i]));
+  }
+  rebuild();
+}
+
+Geodesic::SpatialIndex::SpatialIndex(const GeoPoint *points, const uint32_t *ids, std::size_t count):
+SpatialIndex{} {
+  m_owned.reserve(count);
+  for(std::size_t i = 0; i < count; ++i) {
+    points[i].validate();
+    m_owned.push_back(make_entry(ids[i], points[i]));
+  }
+  rebuild();
+}
+
+Geodesic::SpatialIndex::SpatialIndex(const LocationData *locations, std::size_t count):
+SpatialIndex{} {
+  m_owned.reserve(count);
+  for(std::size_t i = 0; i < count; ++i) {
+    m_owned.push_back(make_entry(static_cast<uint32_t>(i), locations[i].get_point()));
+  }
+  rebuild();
+}
+
+//NOTE - Gathers the live tree entries (or, on first build, whatever sits in m_owned) with the pending ones and re-sorts
+auto Geodesic::SpatialIndex::rebuild() -> void {
+  std::vector<IndexEntry> entries{};
+
+  if(m_entries == nullptr) {
+    entries = std::move(m_owned);
+  }
+  else {
+    entries.reserve(m_count - m_erased + m_pending.size());
+    std::copy_if(m_entries, m_entries + m_count, std::back_inserter(entries), [](const IndexEntry &entry) { return !entry.erased; });
+  }
+  entries.insert(entries.end(), m_pending.begin(), m_pending.end());
+
+  build_tree(entries.data(), 0, entries.size());
+
+  m_owned   = std::move(entries);
+  m_entries = m_owned.data();
+  m_count   = m_owned.size();
+  m_erased  = 0;
+  m_pending.clear();
+  m_slots.clear();
+  m_mapping.reset();
+}
+
+//NOTE - A memory-mapped index is read-only, the first erase copies it into memory
+auto Geodesic::SpatialIndex::make_owned() -> void {
+  if(m_mapping) {
+    m_owned.assign(m_entries, m_entries + m_count);
+    m_entries = m_owned.data();
+    m_mapping.reset();
+  }
+}
+
+auto Geodesic::SpatialIndex::insert(uint32_t id, const GeoPoint &point) -> void {
+  point.validate();
+  m_pending.push_back(make_entry(id, point));
+  if(m_pending.size() >= PENDING_LIMIT) {
+    rebuild();
+  }
+}
+
+auto Geodesic::SpatialIndex::erase(uint32_t id) -> bool {
+  const auto pending{std::find_if(m_pending.begin(), m_pending.end(), [id](const IndexEntry &entry) { return entry.id == id; })};
+  if(pending != m_pending.end()) {
+    *pending = m_pending.back();
+    m_pending.pop_back();
+    return true;
+  }
+
+  if(m_slots.empty()) {
+    m_slots.reserve(m_count - m_erased);
+    for(std::size_t slot = 0; slot < m_count; ++slot) {
+      if(!m_entries[slot].erased) {
+        m_slots.emplace(m_entries[slot].id, slot);
+      }
+    }
+  }
+
+  const auto found{m_slots.find(id)};
+  if(found == m_slots.end()) {
+    return false;
+  }
+
+  make_owned();
+  m_owned[found->second].erased = 1;
+  m_slots.erase(found);
+  ++m_erased;
+
+  //NOTE - Tombstones still cost traversal time, compact once they reach a quarter of the tree
+  if(m_erased * 4 > m_count) {
+    rebuild();
+  }
+  return true;
+}
+
+auto Geodesic::SpatialIndex::size() const -> std::size_t {
+  return m_count - m_erased + m_pending.size();
+}
+
+auto Geodesic::SpatialIndex::search_radius(std::size_t begin, std::size_t end, const double (&center)[3], const GeoPoint &point, double radius, std::vector<IndexHit> &hits) const -> void {
+  if(begin >= end) {
+    return;
+  }
+
+  const std::size_t middle{begin + (end - begin) / 2};
+  const IndexEntry &entry{m_entries[middle]};
+
+  if(!entry.erased && chord(center, entry.ecef) <= radius + CHORD_SLACK) {
+    const double distance{exact_distance_WGS84(point, entry.point)};
+    if(distance <= radius) {
+      hits.push_back(IndexHit{entry.id, distance});
+    }
+  }
+
+  const double offset{center[entry.axis] - entry.ecef[entry.axis]};
+  if(offset <= 0) {
+    search_radius(begin, middle, center, point, radius, hits);
+    if(-offset <= radius + CHORD_SLACK) {
+      search_radius(middle + 1, end, center, point, radius, hits);
+    }
+  }
+  else {
+    search_radius(middle + 1, end, center, point, radius, hits);
+    if(offset <= radius + CHORD_SLACK) {
+      search_radius(begin, middle, center, point, radius, hits);
+    }
+  }
+}
+
+auto Geodesic::SpatialIndex::within_radius(const GeoPoint &center, double radius, std::vector<IndexHit> &hits) const -> void {
+  hits.clear();
+
+  double ecef[3];
+  to_ecef(center, ecef);
+  search_radius(0, m_count, ecef, center, radius, hits);
+
+  for(const IndexEntry &entry : m_pending) {
+    if(chord(ecef, entry.ecef) <= radius + CHORD_SLACK) {
+      const double distance{exact_distance_WGS84(center, entry.point)};
+      if(distance <= radius) {
+        hits.push_back(IndexHit{entry.id, distance});
+      }
+    }
+  }
+
+  std::sort(hits.begin(), hits.end(), by_distance);
+}
+
+//NOTE - heap is a max-heap on distance holding the best k so far, its front is the current k-th distance
+auto Geodesic::SpatialIndex::search_nearest(std::size_t begin, std::size_t end, const double (&center)[3], const GeoPoint &point, std::size_t k, std::vector<IndexHit> &heap) const -> void {
+  if(begin >= end) {
+    return;
+  }
+
+  const std::size_t middle{begin + (end - begin) / 2};
+  const IndexEntry &entry{m_entries[middle]};
+
+  if(!entry.erased && (heap.size() < k || chord(center, entry.ecef) < heap.front().distance + CHORD_SLACK)) {
+    const double distance{exact_distance_WGS84(point, entry.point)};
+    if(heap.size() < k) {
+      heap.push_back(IndexHit{entry.id, distance});
+      std::push_heap(heap.begin(), heap.end(), by_distance);
+    }
+    else if(distance < heap.front().distance) {
+      std::pop_heap(heap.begin(), heap.end(), by_distance);
+      heap.back() = IndexHit{entry.id, distance};
+      std::push_heap(heap.begin(), heap.end(), by_distance);
+    }
+  }
+
+  const double offset{center[entry.axis] - entry.ecef[entry.axis]};
+  const bool left_first{offset <= 0};
+  if(left_first) {
+    search_nearest(begin, middle, center, point, k, heap);
+  }
+  else {
+    search_nearest(middle + 1, end, center, point, k, heap);
+  }
+
+  if(heap.size() < k || std::abs(offset) < heap.front().distance + CHORD_SLACK) {
+    if(left_first) {
+      search_nearest(middle + 1, end, center, point, k, heap);
+    }
+    else {
+      search_nearest(begin, middle, center, point, k, heap);
+    }
+  }
+}
+
+auto Geodesic::SpatialIndex::nearest(const GeoPoint &center, std::size_t k, std::vector<IndexHit> &hits) const -> void {
+  hits.clear();
+  if(k == 0) {
+    return;
+  }
+  hits.reserve(k);
+
+  double ecef[3];
+  to_ecef(center, ecef);
+  search_nearest(0, m_count, ecef, center, k, hits);
+
+  for(const IndexEntry &entry : m_pending) {
+    if(hits.size() < k || chord(ecef, entry.ecef) < hits.front().distance + CHORD_SLACK) {
+      const double distance{exact_distance_WGS84(center, entry.point)};
+      if(hits.size() < k) {
+        hits.push_back(IndexHit{entry.id, distance});
+        std::push_heap(hits.begin(), hits.end(), by_distance);
+      }
+      else if(distance < hits.front().distance) {
+        std::pop_heap(hits.begin(), hits.end(), by_distance);
+        hits.back() = IndexHit{entry.id, distance};
+        std::push_heap(hits.begin(), hits.end(), by_distance);
+      }
+    }
+  }
+
+  std::sort_heap(hits.begin(), hits.end(), by_distance);
+}
+
+auto Geodesic::SpatialIndex::save(const std::string &path) const -> void {
+
+  //NOTE - Pending inserts and tombstones are folded into a fresh tree so the image is always a clean flat array
+  std::vector<IndexEntry> compacted{};
+  const IndexEntry *entries{m_entries};
+  std::size_t count{m_count};
+
+  if(!m_pending.empty() || m_erased > 0) {
+    compacted.reserve(size());
+    std::copy_if(m_entries, m_entries + m_count, std::back_inserter(compacted), [](const IndexEntry &entry) { return !entry.erased; });
+    compacted.insert(compacted.end(), m_pending.begin(), m_pending.end());
+    build_tree(compacted.data(), 0, compacted.size());
+    entries = compacted.data();
+    count   = compacted.size();
+  }
+
+  IndexFileHeader header{};
+  std::memcpy(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC));
+  header.version    = INDEX_VERSION;
+  header.entry_size = sizeof(IndexEntry);
+  header.count      = count;
+
+  std::ofstream output{path, std::ios::binary | std::ios::trunc};
+  output.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if(count > 0) {
+    output.write(reinterpret_cast<const char*>(entries), static_cast<std::streamsize>(count * sizeof(IndexEntry)));
+  }
+  if(!output) {
+    throw std::runtime_error("\nSpatialIndex::save(" + path + ")\nWriting the index failed.\n");
+  }
+}
+
+auto Geodesic::SpatialIndex::load(const std::string &path) -> SpatialIndex {
+  auto mapping{std::make_unique<MappedFile>(path)};
+
+  IndexFileHeader header{};
+  if(mapping->size() < sizeof(header)) {
+    throw std::runtime_error("\nSpatialIndex::load(" + path + ")\nFile is too small to hold an index.\n");
+  }
+  std::memcpy(&header, mapping->data(), sizeof(header));
+
+  if(std::memcmp(header.magic, INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0 || header.version != INDEX_VERSION || header.entry_size != sizeof(IndexEntry)) {
+    throw std::runtime_error("\nSpatialIndex::load(" + path + ")\nNot an index written by this version.\n");
+  }
+  if(mapping->size() != sizeof(header) + header.count * sizeof(IndexEntry)) {
+    throw std::runtime_error("\nSpatialIndex::load(" + path + ")\nFile size does not match the entry count.\n");
+  }
+
+  SpatialIndex index{};
+  index.m_count   = static_cast<std::size_t>(header.count);
+  index.m_entries = (header.count > 0) ? reinterpret_cast<const IndexEntry*>(mapping->data() + sizeof(header)) : nullptr;
+  index.m_erased  = static_cast<std::size_t>(std::count_if(index.m_entries, index.m_entries + index.m_count, [](const IndexEntry &entry) { return entry.erased != 0; }));
+  index.m_mapping = std::move(mapping);
+  return index;
+}
@@ -0,0 +1,129 @@
+#include "ThreadPool.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+ThreadPool::ThreadPool(std::size_t thread_count) {
+  if(thread_count == 0) {
+    thread_count = std::thread::hardware_concurrency();
+  }
+  if(thread_count == 0) {
+    thread_count = 1;
+  }
+
+  for(std::size_t i = 0; i < thread_count; ++i) {
+    m_queues.emplace_back(std::make_unique<WorkQueue>());
+  }
+  for(std::size_t i = 0; i < thread_count; ++i) {
+    m_threads.emplace_back(&ThreadPool::run_worker, this, i);
+  }
+}
+
+auto ThreadPool::submit(std::function<void()> task) -> void {
+  const std::size_t queue{m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size()};
+  {
+    std::lock_guard<std::mutex> lock{m_queues[queue]->mutex};
+    m_queues[queue]->tasks.emplace_back(std::move(task));
+  }
+  {
+    std::lock_guard<std::mutex> lock{m_state_mutex};
+    ++m_queued;
+    ++m_unfinished;
+  }
+  m_task_ready.notify_one();
+}
+
+auto ThreadPool::try_pop(std::size_t worker, std::function<void()> &task) -> bool {
+
+  //NOTE - Own queue first, newest task (still warm in cache)
+  {
+    WorkQueue &own{*m_queues[worker]};
+    std::lock_guard<std::mutex> lock{own.mutex};
+    if(!own.tasks.empty()) {
+      task = std::move(own.tasks.back());
+      own.tasks.pop_back();
+      return true;
+    }
+  }
+
+  //NOTE - Steal the oldest task of another worker
+  for(std::size_t offset = 1; offset < m_queues.size(); ++offset) {
+    WorkQueue &victim{*m_queues[(worker + offset) % m_queues.size()]};
+    std::lock_guard<std::mutex> lock{victim.mutex};
+    if(!victim.tasks.empty()) {
+      task = std::move(victim.tasks.front());
+      victim.tasks.pop_front();
+      return true;
+    }
+  }
+
+  return false;
+}
+
+auto ThreadPool::run_worker(std::size_t worker) -> void {
+  std::function<void()> task{};
+
+  while(true) {
+    {
+      std::unique_lock<std::mutex> lock{m_state_mutex};
+      m_task_ready.wait(lock, [this] { return m_stop || m_queued > 0; });
+      if(m_queued == 0) {
+        return;
+      }
+      --m_queued;
+    }
+
+    //NOTE - m_queued reserved a task for this worker, spin until the deque that holds it is visible
+    while(!try_pop(worker, task)) {
+      std::this_thread::yield();
+    }
+
+    //NOTE - A throwing task must not take the worker down (std::terminate), its exception is handed to wait()
+    std::exception_ptr failure{};
+    try {
+      task();
+    }
+    catch(...) {
+      failure = std::current_exception();
+    }
+    task = nullptr;
+
+    {
+      std::lock_guard<std::mutex> lock{m_state_mutex};
+      if(failure && !m_failure) {
+        m_failure = failure;
+      }
+      if(--m_unfinished == 0) {
+        m_all_done.notify_all();
+      }
+    }
+  }
+}
+
+auto ThreadPool::wait() -> void {
+  std::unique_lock<std::mutex> lock{m_state_mutex};
+  m_all_done.wait(lock, [this] { return m_unfinished == 0; });
+  if(m_failure) {
+    std::rethrow_exception(std::exchange(m_failure, nullptr));
+  }
+}
+
+auto ThreadPool::thread_count() const -> std::size_t {
+  return m_threads.size();
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock{m_state_mutex};
+    m_stop = true;
+  }
+  m_task_ready.notify_all();
+  for(std::thread &thread : m_threads) {
+    thread.join();
+  }
+}